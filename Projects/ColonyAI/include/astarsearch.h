@@ -0,0 +1,63 @@
+#pragma once
+#ifndef ASTARSEARCH_H
+#define ASTARSEARCH_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <iostream>
+#include <queue>
+#include "cellgrid.h"
+#include "gridsearch.h"
+#include "landmarks.h"
+#include "navgrid.h"
+#include "node.h"
+#include "searchbuffer.h"
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for searching the grid with A*
+///
+/// The search state lives in the SearchBuffer rather than the search, so a
+/// time-sliced search can be expanded a budget at a time by a new
+/// AStarSearch each update.
+///
+/////////////////////////////////////////////////
+class AStarSearch : public GridSearch
+{
+private:
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param kGrid Grid of Nodes to search over
+	/// \param kCells Inaccessible bit of each Node
+	/// \param kHeuristic Estimate of the distance left
+	/// \param kpLandmarks Landmark tables whose bounds are admissible, nullptr if there are none that are
+	/// \param log Stream to write progress to
+	///
+	/////////////////////////////////////////////////
+	AStarSearch(const NavGrid& kGrid, const CellGrid& kCells, const Heuristic kHeuristic, const Landmarks* kpLandmarks, std::ostream& log);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Expands an A* search from the current Node until it ends or the budget is spent
+	///
+	/// \param buffer The search state, kept between calls to resume the search
+	/// \param uiCurrent Index of the Node to expand next, left at the next Node to expand when yielding
+	/// \param kuiTarget Index of the Node to route toward
+	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
+	/// \param uiBudget Most Nodes to expand before yielding
+	/// \param path Queue to set to the path when one is found
+	///
+	/// \return Whether the search is still going, found a path or failed
+	///
+	/////////////////////////////////////////////////
+	SearchStatus expand(SearchBuffer& buffer, unsigned int& uiCurrent, const unsigned int kuiTarget, const bool kbIgnoreAccess, unsigned int uiBudget, std::queue<sf::Vector2f>& path);
+};
+
+#endif
\ No newline at end of file
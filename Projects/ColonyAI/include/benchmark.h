@@ -0,0 +1,137 @@
+#pragma once
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// Imports
+#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+#include <cmath>
+#include <thread>
+#include <stdlib.h>
+#include "environment.h"
+#include "pathfinding.h"
+#include "searchbuffer.h"
+
+//!< Struct that holds a single path query
+struct Query
+{
+	sf::Vector2f m_start; //!< Position to path from
+	unsigned int m_uiTarget; //!< Index of the Node to path to
+};
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for timing Pathfinding over a loaded Environment
+///
+/////////////////////////////////////////////////
+class Benchmark
+{
+private:
+
+	unsigned int m_uiQueries; //!< Number of path queries per run
+	unsigned int m_uiSeed; //!< Seed for generating the queries
+
+	const float m_kfColonistRadius = 7.5f; //!< Clearance radius, matches the Colonist radius
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Marks every Object in the Environment as known to a Pathfinding
+	///
+	/// \param pEnv The Environment containing the Objects
+	/// \param pathfinding The Pathfinding to mark Nodes inaccessible on
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void learnObjects(std::shared_ptr<Environment> pEnv, Pathfinding& pathfinding);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Generates queries between random accessible Nodes
+	///
+	/// \param pathfinding The Pathfinding to pick Nodes from
+	///
+	/// \return Vector of queries
+	///
+	/////////////////////////////////////////////////
+	std::vector<Query> generateQueries(Pathfinding& pathfinding);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Times a set of queries and prints the results
+	///
+	/// \param ksName Name printed with the results
+	/// \param kMode Search algorithm to time
+	/// \param kHeuristic Estimate of the distance left to use
+	/// \param kbSmoothing Whether to smooth the paths
+	/// \param pathfinding The Pathfinding to run the queries on
+	/// \param kQueries The queries to run
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void runCase(const std::string ksName, const SearchMode kMode, const Heuristic kHeuristic, const bool kbSmoothing, Pathfinding& pathfinding, const std::vector<Query>& kQueries);
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param kuiQueries Number of path queries per run
+	/// \param kuiSeed Seed for generating the queries
+	///
+	/////////////////////////////////////////////////
+	Benchmark(const unsigned int kuiQueries, const unsigned int kuiSeed);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Loads an Environment file and benchmarks Pathfinding within it
+	///
+	/// \param ksFilePath The Env file path to load
+	///
+	/// \return Whether the Environment was loaded successfully
+	///
+	/////////////////////////////////////////////////
+	bool run(const std::string ksFilePath);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Generates an Environment of scattered Objects and times its updates
+	///
+	/// The Environment is sized to keep the Objects as dense as the large
+	/// benchmark maps and starts without Entities, so the timing is of the
+	/// typed Bush and Food loops as the Bushes drop Food.
+	///
+	/// \param kuiObjects Number of Objects to scatter
+	/// \param kuiUpdates Number of updates to time
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void runUpdates(const unsigned int kuiObjects, const unsigned int kuiUpdates);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Generates an Environment of Colonists among scattered Objects and times its updates at each thread count
+	///
+	/// The same Environment is loaded fresh and rand() reseeded for each
+	/// thread count, from the update thread alone up to 8 threads.
+	///
+	/// \param kuiColonists Number of Colonists to scatter, with twice as many Objects
+	/// \param kuiUpdates Number of updates to time at each thread count
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void runThreads(const unsigned int kuiColonists, const unsigned int kuiUpdates);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+#ifndef BIDIRECTIONALSEARCH_H
+#define BIDIRECTIONALSEARCH_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <iostream>
+#include <queue>
+#include <limits>
+#include "cellgrid.h"
+#include "gridsearch.h"
+#include "landmarks.h"
+#include "navgrid.h"
+#include "node.h"
+#include "searchbuffer.h"
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for searching the grid with A* run from both ends until they meet
+///
+/// Each end keeps its own SearchBuffer. Stops once either end's smallest F
+/// value is no less than the shortest path through a Node both ends have
+/// reached, so the path is optimal.
+///
+/////////////////////////////////////////////////
+class BidirectionalSearch : public GridSearch
+{
+private:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Expands a Node for one end of a bidirectional search
+	///
+	/// \param buffer The search state of the end expanding
+	/// \param kOther The search state of the other end
+	/// \param kuiNode Index of the Node to expand
+	/// \param kuiGoal Index of the Node this end is routing toward
+	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
+	/// \param fBest Cost of the shortest path through a Node both ends have reached
+	/// \param uiMeet Index of the Node that path goes through
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void expandFromEnd(SearchBuffer& buffer, const SearchBuffer& kOther, const unsigned int kuiNode, const unsigned int kuiGoal, const bool kbIgnoreAccess, float& fBest, unsigned int& uiMeet) const;
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param kGrid Grid of Nodes to search over
+	/// \param kCells Inaccessible bit of each Node
+	/// \param kHeuristic Estimate of the distance left
+	/// \param kpLandmarks Landmark tables whose bounds are admissible, nullptr if there are none that are
+	/// \param log Stream to write progress to
+	///
+	/////////////////////////////////////////////////
+	BidirectionalSearch(const NavGrid& kGrid, const CellGrid& kCells, const Heuristic kHeuristic, const Landmarks* kpLandmarks, std::ostream& log);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Creates a path to target Node with A* run from both ends until they meet
+	///
+	/// \param forward The search state from the start, with the start Node visited and closed
+	/// \param backward The search state for the end at the target, started by the search
+	/// \param kuiStart Index of the Node the search starts at
+	/// \param kuiTarget Index of the Node to route toward
+	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
+	///
+	/// \return A queue of points that represent a route, empty if there is none
+	///
+	/////////////////////////////////////////////////
+	std::queue<sf::Vector2f> search(SearchBuffer& forward, SearchBuffer& backward, const unsigned int kuiStart, const unsigned int kuiTarget, const bool kbIgnoreAccess);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+#ifndef BUFFERPOOL_H
+#define BUFFERPOOL_H
+
+// Imports
+#include <memory>
+#include <vector>
+#include <functional>
+#include <mutex>
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for lending full grid buffers to the Pathfinding that needs one right now
+///
+/// A Pathfinding only needs a replanner or a time-sliced search buffer
+/// while it's using it, so rather than each holding its own, buffers are
+/// lent out and returned. A returned buffer keeps its size, so the grid is
+/// only allocated for as many buffers as are ever lent at once.
+///
+/////////////////////////////////////////////////
+template <typename T>
+class BufferPool
+{
+private:
+
+	std::function<T*()> m_create; //!< Creates a buffer when none are free
+
+	std::vector<std::shared_ptr<T>> m_pFree; //!< Buffers returned and waiting to be lent again
+
+	unsigned int m_uiCreated = 0; //!< Count of buffers ever created
+
+	std::mutex m_mutex; //!< Guards the free buffers, lent from any thread
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param create Creates a buffer sized for the grid
+	///
+	/////////////////////////////////////////////////
+	BufferPool(std::function<T*()> create) { m_create = create; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Lends a buffer, creating one if none are free
+	///
+	/// \return The buffer, holding whatever state it was returned with
+	///
+	/////////////////////////////////////////////////
+	std::shared_ptr<T> acquire()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		// If no buffer is free: creates one
+		if (m_pFree.empty())
+		{
+			m_uiCreated++;
+			return std::shared_ptr<T>(m_create());
+		}
+
+		// Lends the last buffer returned
+		std::shared_ptr<T> pBuffer = m_pFree.back();
+		m_pFree.pop_back();
+		return pBuffer;
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns a lent buffer
+	///
+	/// \param pBuffer The buffer, cleared once it's returned
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void release(std::shared_ptr<T>& pBuffer)
+	{
+		// If nothing is lent: nothing to return
+		if (pBuffer == nullptr) return;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_pFree.push_back(pBuffer);
+		pBuffer = nullptr;
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the count of buffers ever created
+	///
+	/// \return Count of buffers, free or lent
+	///
+	/////////////////////////////////////////////////
+	unsigned int getCreated() { std::lock_guard<std::mutex> lock(m_mutex); return m_uiCreated; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the memory held by the free buffers
+	///
+	/// \return Size in bytes
+	///
+	/////////////////////////////////////////////////
+	size_t getMemoryUsage()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		size_t memory = 0;
+		for (const std::shared_ptr<T>& kpBuffer : m_pFree) memory += kpBuffer->getMemoryUsage();
+		return memory;
+	}
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,212 @@
+#pragma once
+#ifndef CELLGRID_H
+#define CELLGRID_H
+
+// Imports
+#include <vector>
+#include "neighbours.h"
+#include "node.h"
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for the inaccessible bits of a grid of Nodes, bordered by off grid cells
+///
+/// Each Node has one cell, and a ring of off grid cells surrounds the grid
+/// so finding neighbours never has to check the grid's bounds. Every
+/// search over the grid finds neighbours here, with g_kaNeighbourOffsets.
+///
+/////////////////////////////////////////////////
+class CellGrid
+{
+private:
+
+	unsigned int m_uiCols = 0; //!< Count of columns of Nodes
+	unsigned int m_uiRows = 0; //!< Count of rows of Nodes
+	unsigned int m_uiPaddedCols = 0; //!< Count of columns of cells, the Nodes plus the border either side
+
+	unsigned int m_uiBlockedCount = 0; //!< Count of Nodes flagged inaccessible
+
+	std::vector<unsigned char> m_cells; //!< Flags of each cell, row by row
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines the cell of a Node
+	///
+	/// \param kuiNode Index of the Node, must be within the grid
+	///
+	/// \return Index of the cell
+	///
+	/////////////////////////////////////////////////
+	unsigned int cellOf(const unsigned int kuiNode) const { return kuiNode + ((kuiNode / m_uiCols) * 2) + m_uiPaddedCols + 1; }
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Default constructor, a grid without Nodes
+	///
+	/////////////////////////////////////////////////
+	CellGrid() {}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor, every Node starts accessible
+	///
+	/// \param kuiCols Count of columns of Nodes
+	/// \param kuiRows Count of rows of Nodes
+	///
+	/////////////////////////////////////////////////
+	CellGrid(const unsigned int kuiCols, const unsigned int kuiRows);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Flags a Node as inaccessible
+	///
+	/// \param kuiNode Index of the Node, must be within the grid
+	///
+	/// \return Whether the Node was accessible before
+	///
+	/////////////////////////////////////////////////
+	bool block(const unsigned int kuiNode);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether a Node is flagged inaccessible
+	///
+	/// \param kuiNode Index of the Node, must be within the grid
+	///
+	/// \return Whether the Node is inaccessible
+	///
+	/////////////////////////////////////////////////
+	bool isBlocked(const unsigned int kuiNode) const { return (m_cells[cellOf(kuiNode)] & g_kucBlocked) != 0; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines whether the Node at a column and row can be walked on
+	///
+	/// \param kiX Column of the Node
+	/// \param kiY Row of the Node
+	///
+	/// \return Whether the Node is on the grid and accessible
+	///
+	/////////////////////////////////////////////////
+	bool walkable(const int kiX, const int kiY) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines whether a step from a Node in a direction can be taken
+	///
+	/// Diagonal steps need both orthogonal neighbours open, the rule
+	/// adjacentNodes applies when diagonals are strict.
+	///
+	/// \param kiX Column of the Node stepped from
+	/// \param kiY Row of the Node stepped from
+	/// \param kiDX Column step, -1, 0 or 1
+	/// \param kiDY Row step, -1, 0 or 1
+	///
+	/// \return Whether the step is open
+	///
+	/////////////////////////////////////////////////
+	bool stepOpen(const int kiX, const int kiY, const int kiDX, const int kiDY) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines whether a step between two neighbouring Nodes can be taken
+	///
+	/// \param kuiFrom Index of the Node stepped from
+	/// \param kuiTo Index of the neighbouring Node stepped to
+	///
+	/// \return Whether the step is open
+	///
+	/////////////////////////////////////////////////
+	bool stepOpen(const unsigned int kuiFrom, const unsigned int kuiTo) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines whether every Node inaccessible in another grid is inaccessible here
+	///
+	/// \param kOther Grid of the same size to compare with
+	///
+	/// \return Whether this grid's inaccessible Nodes include the other's
+	///
+	/////////////////////////////////////////////////
+	bool covers(const CellGrid& kOther) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Finds the neighbours of a Node
+	///
+	/// \tparam kuiConnectivity 4 for orthogonal neighbours only, 8 to include diagonals
+	///
+	/// \param kuiNode Index of the Node to find the neighbours of
+	/// \param kbStrictDiagonal Boolean for whether to leave out diagonals that cut past an inaccessible Node
+	///
+	/// \return Indices of the neighbours on the grid, in the order of g_kaNeighbourOffsets
+	///
+	/////////////////////////////////////////////////
+	template <unsigned int kuiConnectivity>
+	AdjacentNodes adjacentNodes(const unsigned int kuiNode, const bool kbStrictDiagonal) const
+	{
+		static_assert((kuiConnectivity == 4) || (kuiConnectivity == 8), "Nodes have 4 or 8 neighbours");
+
+		// Defines the neighbours found
+		AdjacentNodes adjNodes;
+
+		// If Node doesn't exist: it has no neighbours
+		if (kuiNode >= getNodeCount()) return adjNodes;
+
+		// Cell of the Node
+		const int kiCell = (int)cellOf(kuiNode);
+
+		// For every step in the table
+		for (const NeighbourOffset& kOffset : g_kaNeighbourOffsets)
+		{
+			// If only stepping orthogonally: skips the diagonals
+			const bool kbDiagonal = (kOffset.m_iDX != 0) && (kOffset.m_iDY != 0);
+			if ((kuiConnectivity == 4) && kbDiagonal) continue;
+
+			// If the neighbour is on the border: it's off the grid
+			const int kiRowStep = kOffset.m_iDY * (int)m_uiPaddedCols;
+			if (m_cells[kiCell + kiRowStep + kOffset.m_iDX] & g_kucOffGrid) continue;
+
+			// If diagonals are strict and the step cuts past an inaccessible Node: ignores it
+			if (kbStrictDiagonal && kbDiagonal && ((m_cells[kiCell + kOffset.m_iDX] | m_cells[kiCell + kiRowStep]) & g_kucBlocked)) continue;
+
+			// Adds adjacent Node
+			adjNodes.m_auiNodes[adjNodes.m_uiCount++] = (unsigned int)((int)kuiNode + (kOffset.m_iDY * (int)m_uiCols) + kOffset.m_iDX);
+		}
+
+		return adjNodes;
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the count of Nodes
+	///
+	/// \return Count of Nodes in the grid
+	///
+	/////////////////////////////////////////////////
+	unsigned int getNodeCount() const { return m_uiCols * m_uiRows; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the count of Nodes flagged inaccessible
+	///
+	/// \return Count of inaccessible Nodes
+	///
+	/////////////////////////////////////////////////
+	unsigned int getBlockedCount() const { return m_uiBlockedCount; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the memory held by the cells
+	///
+	/// \return Size in bytes
+	///
+	/////////////////////////////////////////////////
+	size_t getMemoryUsage() const { return m_cells.capacity(); }
+};
+
+#endif
\ No newline at end of file
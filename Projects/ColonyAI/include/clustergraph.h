@@ -0,0 +1,268 @@
+#pragma once
+#ifndef CLUSTERGRAPH_H
+#define CLUSTERGRAPH_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <memory>
+#include <vector>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include <functional>
+#include <limits>
+#include <algorithm>
+#include "cellgrid.h"
+#include "navgrid.h"
+#include "node.h"
+#include "utils.h"
+
+//!< Struct that holds a crossing between two neighbouring clusters
+struct Entrance
+{
+	unsigned int m_uiNodeA; //!< Index of the Node on the left or upper cluster's side
+	unsigned int m_uiNodeB; //!< Index of the Node on the right or lower cluster's side
+};
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for the abstract graph used by hierarchical pathfinding
+///
+/// The NavGrid is split into square clusters. Where a run of accessible
+/// Nodes crosses the border between two clusters, one or two entrances
+/// are placed along it. The cost between every pair of entrance Nodes
+/// within a cluster is cached, so long routes are planned over entrances
+/// only and each leg is refined within a single cluster when needed.
+///
+/////////////////////////////////////////////////
+class ClusterGraph
+{
+private:
+
+	std::shared_ptr<NavGrid> m_pGrid; //!< Grid of Nodes the clusters are laid over
+
+	unsigned int m_uiClusterSize; //!< Width and height of a cluster in Nodes
+	unsigned int m_uiClusterCols; //!< Count of clusters across the grid
+	unsigned int m_uiClusterRows; //!< Count of clusters down the grid
+
+	bool m_bBuilt = false; //!< Whether the entrances and edges have been built
+
+	std::vector<std::vector<Entrance>> m_rightEntrances; //!< Entrances across the right border of each cluster
+	std::vector<std::vector<Entrance>> m_belowEntrances; //!< Entrances across the bottom border of each cluster
+
+	std::vector<std::vector<unsigned int>> m_clusterNodes; //!< Indices of the entrance Nodes within each cluster
+	std::vector<std::vector<float>> m_clusterCosts; //!< Cached cost between each pair of entrance Nodes within each cluster
+
+	std::vector<bool> m_touched; //!< Clusters whose accessibility changed since the last repair
+	bool m_bTouched = false; //!< Whether any cluster is waiting to be repaired
+
+	std::vector<float> m_fLocalCosts; //!< Cost to each Node of the last cluster search, indexed within the cluster
+	std::vector<unsigned int> m_uiLocalParents; //!< Parent of each Node of the last cluster search, indexed within the cluster
+
+	unsigned int m_uiExpansions = 0; //!< Count of Nodes expanded by cluster and abstract searches
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines whether a Node within a cluster can be walked on
+	///
+	/// \param kuiCluster Index of the cluster the Node must be within
+	/// \param kiX Column of the Node
+	/// \param kiY Row of the Node
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return Whether the Node is walkable
+	///
+	/////////////////////////////////////////////////
+	bool walkable(const unsigned int kuiCluster, const int kiX, const int kiY, const CellGrid& kCells) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Searches outward from a Node without leaving its cluster
+	///
+	/// \param kuiCluster Index of the cluster to search within
+	/// \param kuiStart Index of the Node to search from
+	/// \param kuiTarget Index of the Node to stop at, g_kuiNoNode to search the whole cluster
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void searchCluster(const unsigned int kuiCluster, const unsigned int kuiStart, const unsigned int kuiTarget, const CellGrid& kCells);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the cost to a Node from the last cluster search
+	///
+	/// \param kuiCluster Index of the cluster that was searched
+	/// \param kuiNode Index of the Node within the cluster
+	///
+	/// \return Cost to the Node, infinity if it wasn't reached
+	///
+	/////////////////////////////////////////////////
+	float localCost(const unsigned int kuiCluster, const unsigned int kuiNode) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Places the entrances along the border after a cluster
+	///
+	/// \param kuiCluster Index of the cluster on the left or upper side
+	/// \param kbBelow Whether the border is below the cluster, otherwise right of it
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void buildBorder(const unsigned int kuiCluster, const bool kbBelow, const CellGrid& kCells);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gathers a cluster's entrance Nodes and caches the costs between them
+	///
+	/// \param kuiCluster Index of the cluster
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void buildCluster(const unsigned int kuiCluster, const CellGrid& kCells);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Generates the entrance Nodes connected to an entrance Node and the cost to each
+	///
+	/// \param kuiNode Index of the entrance Node
+	/// \param edges Vector to add the connected Nodes and costs to
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void entranceEdges(const unsigned int kuiNode, std::vector<std::pair<unsigned int, float>>& edges) const;
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param pGrid Grid of Nodes to lay the clusters over
+	/// \param kuiClusterSize Width and height of a cluster in Nodes
+	///
+	/////////////////////////////////////////////////
+	ClusterGraph(std::shared_ptr<NavGrid> pGrid, const unsigned int kuiClusterSize);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Builds every entrance and cached edge
+	///
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void build(const CellGrid& kCells);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Flags the cluster of a Node as needing repair
+	///
+	/// \param kuiNode Index of the Node whose accessibility changed
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void touch(const unsigned int kuiNode);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Rebuilds the entrances and edges of touched clusters and their neighbours
+	///
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void repair(const CellGrid& kCells);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Plans a route over the entrances between two Nodes
+	///
+	/// \param kuiStart Index of the Node to route from
+	/// \param kuiTarget Index of the Node to route toward
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return Indices of the waypoints from start to target, empty if there is no route
+	///
+	/////////////////////////////////////////////////
+	std::vector<unsigned int> findRoute(const unsigned int kuiStart, const unsigned int kuiTarget, const CellGrid& kCells);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Refines one leg of a route into the Nodes to walk
+	///
+	/// \param kuiFrom Index of the waypoint the leg starts at
+	/// \param kuiTo Index of the waypoint the leg ends at
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return Indices of the Nodes after the start up to and including the end, empty if the leg is blocked
+	///
+	/////////////////////////////////////////////////
+	std::vector<unsigned int> refine(const unsigned int kuiFrom, const unsigned int kuiTo, const CellGrid& kCells);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the index of the cluster a Node is within
+	///
+	/// \param kuiNode Index of the Node
+	///
+	/// \return Cluster index
+	///
+	/////////////////////////////////////////////////
+	unsigned int clusterOf(const unsigned int kuiNode) const
+	{
+		return ((kuiNode % m_pGrid->getCols()) / m_uiClusterSize) + (m_uiClusterCols * ((kuiNode / m_pGrid->getCols()) / m_uiClusterSize));
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether two Nodes are in the same or neighbouring clusters
+	///
+	/// \param kuiNodeA Index of a Node
+	/// \param kuiNodeB Index of another Node
+	///
+	/// \return Whether the clusters are within one of each other
+	///
+	/////////////////////////////////////////////////
+	bool clustersNear(const unsigned int kuiNodeA, const unsigned int kuiNodeB) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether the entrances and edges have been built
+	///
+	/// \return Whether the graph is built
+	///
+	/////////////////////////////////////////////////
+	bool isBuilt() const { return m_bBuilt; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of Nodes expanded by cluster and abstract searches so far
+	///
+	/// \return Expansion count
+	///
+	/////////////////////////////////////////////////
+	unsigned int getExpansions() const { return m_uiExpansions; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the memory held by the entrances, cached costs and cluster search
+	///
+	/// \return Size in bytes
+	///
+	/////////////////////////////////////////////////
+	size_t getMemoryUsage() const;
+};
+
+#endif
\ No newline at end of file
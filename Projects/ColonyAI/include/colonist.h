@@ -13,67 +13,13 @@
 #include "memory.h"
 #include "pathfinding.h"
 #include "utils.h"
+#include "needs.h"
+#include "colonistcomponents.h"
 
 class Entity;
 class Pathfinding;
 class Food;
 
-//!< Struct that holds Colonist needs data
-struct Needs
-{
-public:
-	//!< Default Constructor
-	Needs() {}
-
-	//!< Constructor
-	Needs(const float kfFatalHunger, const float kfFatalThirst)
-	{
-		// Sets member values to corresponding input
-		m_fFatalHunger = kfFatalHunger;
-		m_fFatalThirst = kfFatalThirst;
-		// Defines initial hunger and thirst as 25% of fatal levels
-		setHunger(kfFatalHunger*0.25f);
-		setThirst(kfFatalThirst*0.25f);
-	}
-
-	//!< Sets Hunger level to a new value
-	void setHunger(const float kfHunger)
-	{
-		// Sets value
-		m_fHunger = kfHunger;
-
-		// Caps value between minimum and max Hunger
-		if (m_fHunger < 0.0f) m_fHunger = 0.0f;
-		else if (m_fHunger > m_fFatalHunger) m_fHunger = m_fFatalHunger;
-	}
-	//!< Gets Hunger level
-	float getHunger() { return m_fHunger; }
-	//!< Gets HungerPerc level
-	float getHungerPerc() const { return (m_fHunger / m_fFatalHunger) * 100.0f; }
-
-	//!< Sets Thirst level to a new value
-	void setThirst(const float kfThirst)
-	{
-		// Sets value
-		m_fThirst = kfThirst;
-
-		// Caps value between minimum and max Thirst
-		if (m_fThirst < 0.0f) m_fThirst = 0.0f;
-		else if (m_fThirst > m_fFatalThirst) m_fThirst = m_fFatalThirst;
-	}
-	//!< Gets Thirst level
-	float getThirst() { return m_fThirst; }
-	//!< Gets ThirstPerc level
-	float getThirstPerc() const { return (m_fThirst / m_fFatalThirst) * 100.0f; }
-
-private:
-	float m_fHunger; //!< Hunger need level of the Colonist
-	float m_fThirst; //!< Thirst need level of the Colonist
-
-	float m_fFatalHunger; //!< Hunger need level that kills the Colonist
-	float m_fFatalThirst; //!< Thirst need level that kills the Colonist
-};
-
 /////////////////////////////////////////////////
 ///
 /// \brief Subclass for Colonist Entities
@@ -89,9 +35,8 @@ private:
 	float m_fVision; //!< Radial size of Colonist vision
 	float m_fReach; //!< Radial size of the Colonist's reach
 
-	Needs m_needs; //!< Hunger and Thirst data
-
-	float m_fBirthCooldown; //!< Reproduction cooldown in seconds
+	std::shared_ptr<ColonistComponents> m_pComponents; //!< Store holding the Colonist's needs, reproduction cooldown, position, path and Memories
+	unsigned int m_uiSlot; //!< Slot of the Colonist in the component store
 
 	sf::Vector2f m_homePos; //!< Home position
 	std::vector<std::shared_ptr<Object>> m_pClearObjs; //!< Objects with clear routes to from home
@@ -101,62 +46,122 @@ private:
 	enum aiState { DECEASED, TENDTONEEDS, REPRODUCE, LABOUR }; //!< Enum for AI behavioural types
 	aiState m_state; //!< Current AI state of the Colonist
 
-	std::shared_ptr<Pathfinding> m_pPathfinding; //!< Pathfinding Object for calculating paths
-	
-	std::vector<std::shared_ptr<Memory>> m_pMemories; //!< Vector of Colonist Memory data
+	std::shared_ptr<Pathfinding> m_pPathfinding; //!< Pathfinding Object for calculating paths, which plans the path component
+
+	std::vector<unsigned int> m_nearby; //!< Indices of what the last vision query found, reused so queries don't allocate
+
+	std::vector<std::shared_ptr<Object>> m_pNewlySeen; //!< Objects learned of since the Colonist last decided, for Node accessibility to be calculated with
+	std::vector<Memory> m_newMemories; //!< Memories perceived this update, added to the component store once every Colonist has perceived
+	std::vector<std::shared_ptr<Colonist>> m_pColonistsInVision; //!< Colonists seen this update, for Memories to be shared with
+
+	bool m_bBirthPending = false; //!< Whether the Colonist decided to reproduce, the birth is committed in update
+	bool m_bExplorePending = false; //!< Whether the Colonist decided to explore, its random destination is picked in update
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Draws the Colonist to the RenderTarget
+	/// \brief Returns the Colonist's needs from the component store
 	///
-	/// \param target The RenderTarget to draw on
-	/// \param states The corresponding RenderStates
+	/// \return The Hunger and Thirst data by reference
 	///
-	/// \return void
+	///////////////////////////////////////////////// 
+	Needs& needs() { return m_pComponents->getNeeds(m_uiSlot); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Colonist's needs from the component store
+	///
+	/// \return The Hunger and Thirst data by const reference
 	///
 	///////////////////////////////////////////////// 
-	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+	const Needs& needs() const { return m_pComponents->getNeeds(m_uiSlot); }
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Updates the Colonist with elapsed time
+	/// \brief Returns the Colonist's position in the component store, through the pointer to its slot
 	///
-	/// \param kfElapsedTime The time passed since last update in seconds
+	/// \return In-world coordinates by reference
+	///
+	///////////////////////////////////////////////// 
+	sf::Vector2f& position() { return *m_pPosition; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Colonist's position in the component store, through the pointer to its slot
+	///
+	/// \return In-world coordinates by const reference
+	///
+	///////////////////////////////////////////////// 
+	const sf::Vector2f& position() const { return *m_pPosition; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Colonist's Memories from the component store
+	///
+	/// \return Span of the Memories, valid until Memories are next added
+	///
+	///////////////////////////////////////////////// 
+	Span<Memory> memories() { return m_pComponents->getMemories(m_uiSlot); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Colonist's Memories from the component store
+	///
+	/// \return Span of the Memories as const, valid until Memories are next added
+	///
+	///////////////////////////////////////////////// 
+	Span<const Memory> memories() const { return m_pComponents->getMemories(m_uiSlot); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Draws the Colonist to the RenderTarget
+	///
+	/// \param target The RenderTarget to draw on
+	/// \param states The corresponding RenderStates
 	///
 	/// \return void
 	///
 	///////////////////////////////////////////////// 
-	void update(const float kfElapsedTime);
+	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Sets the Memories vector to a new value
+	/// \brief Adds copies of Memories held in another component store to the Colonist's
 	///
-	/// \param kpMemories A new Memories value
+	/// \param kMemories Memories to copy, which adding to the same store would move
 	///
 	/// \return void
 	///
 	///////////////////////////////////////////////// 
-	void setMemories(const std::vector<std::shared_ptr<Memory>> kpMemories) 
+	void setMemories(const Span<const Memory> kMemories) 
 	{
 		// For all Memories
-		for (std::shared_ptr<Memory> pMemory : kpMemories)
+		for (const Memory& kMemory : kMemories)
 		{
-			// Pushes new ptr onto member
-			m_pMemories.push_back(std::shared_ptr<Memory>(pMemory.get()));
+			// Adds a copy to the component store, so the Colonists don't share a Memory
+			m_pComponents->addMemory(m_uiSlot, kMemory);
 		}
 	}
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Updates the Colonist's Memory
+	/// \brief Marks the Nodes made inaccessible by the Objects learned of since the Colonist last decided
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void learn();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Shares Memories with the Colonists seen this update
 	///
-	/// \param klTime The current time
+	/// Reads the other Colonists' Memories, so it's run in order with their
+	/// updates. The Objects learned of are marked when the Colonist next decides.
 	///
 	/// \return void
 	///
 	///////////////////////////////////////////////// 
-	void updateMemory(const long klTime);
+	void shareMemories();
 
 	/////////////////////////////////////////////////
 	///
@@ -205,13 +210,24 @@ private:
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Paths the Colonist forward with a random heading
+	/// \brief Paths the Colonist toward a source in vision, or decides to explore
 	///
 	/// \return void
 	///
 	///////////////////////////////////////////////// 
 	void wander();
 
+	/////////////////////////////////////////////////
+	///
+	/// \brief Requests a path forward with a random heading
+	///
+	/// Draws from rand(), so it's run in order with the other Colonists' updates.
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void explore();
+
 	/////////////////////////////////////////////////
 	///
 	/// \brief Sets the clearObjs vector to a new value
@@ -226,8 +242,8 @@ private:
 		// For all clearObjs
 		for (std::shared_ptr<Object> pClearObj : kpClearObjs)
 		{
-			// Pushes new ptr onto member
-			m_pClearObjs.push_back(std::shared_ptr<Object>(pClearObj.get()));
+			// Pushes ptr onto member, the Object is shared with the Environment
+			m_pClearObjs.push_back(pClearObj);
 		}
 	}
 
@@ -260,18 +276,6 @@ private:
 	///////////////////////////////////////////////// 
 	void eat(std::shared_ptr<Food> pFood);
 
-	/////////////////////////////////////////////////
-	///
-	/// \brief Moves the Colonist toward a destination at an input speed
-	///
-	/// \param kDestination A position to move toward
-	/// \param kfElapsedTime kfElapsedTime The time passed since last update in seconds
-	///
-	/// \return Whether Colonist is at the destination
-	///
-	///////////////////////////////////////////////// 
-	bool moveTo(const sf::Vector2f kDestination, const float kfElapsedTime);
-
 	/////////////////////////////////////////////////
 	///
 	/// \brief Returns whether an item is within vision
@@ -311,6 +315,95 @@ public:
 	///////////////////////////////////////////////// 
 	Colonist(std::shared_ptr<Environment> pEnv, const sf::Vector2f kPosition, const float kfHeading);
 
+	/////////////////////////////////////////////////
+	///
+	/// \brief Moves the Colonist's components into a store, taking a slot there
+	///
+	/// \param pComponents The store to move into, whose next slot the Colonist takes
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void setComponentStore(std::shared_ptr<ColonistComponents> pComponents);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Points the Entity position at the Colonist's slot in the component store
+	///
+	/// Positions are read through the pointer so reading them isn't a
+	/// virtual call. The store's positions move when a Colonist is added
+	/// and they run out of room, so the Environment calls this again then.
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void bindPosition() { m_pPosition = &m_pComponents->getPosition(m_uiSlot); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Takes in what the Colonist can see, only reading the rest of the Environment
+	///
+	/// Updates the Colonist's Memories of the Objects in vision and holds
+	/// what's new for commitMemories, the Objects learned of for learn and
+	/// the Colonists seen for shareMemories.
+	///
+	/// \param klTime The current time, stamped on the Memories
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void perceive(const long klTime);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds the Memories perceived this update to the component store
+	///
+	/// Adding can move every Colonist's Memories, so it's run in order
+	/// between every Colonist perceiving and deciding.
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void commitMemories();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Decides what the Colonist does this update, only changing itself
+	///
+	/// Marks the Nodes made inaccessible by what it perceived, picks its
+	/// state and plans the path toward it. Nothing outside the Colonist is
+	/// changed, so every Colonist can decide at once before any updates.
+	/// Births and exploring are left for update to commit.
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void decide();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Commits what the Colonist decided with elapsed time
+	///
+	/// Collects the path requested, gives birth, shares Memories and
+	/// requests a path to explore with, in order with the other Colonists.
+	/// The movement system moves the Colonist afterwards.
+	///
+	/// \param kfElapsedTime The time passed since last update in seconds
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void update(const float kfElapsedTime);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Follows up the movement system: moves the Colonist between spatial hash buckets and refines the path past a waypoint reached
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void commitMovement();
+
 	/////////////////////////////////////////////////
 	///
 	/// \brief Gets whether the Colonist is alive
@@ -331,12 +424,21 @@ public:
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Gets the Colonist Memory vector
+	/// \brief Gets the Colonist's Memories
+	///
+	/// \return Span of the Memories as const, valid until Memories are next added
+	///
+	///////////////////////////////////////////////// 
+	Span<const Memory> getMemories() const { return memories(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the Colonist's Pathfinding
 	///
-	/// \return Vector of Memories
+	/// \return Pointer to the Pathfinding
 	///
 	///////////////////////////////////////////////// 
-	std::vector<std::shared_ptr<Memory>> getMemories() { return m_pMemories; }
+	std::shared_ptr<Pathfinding> getPathfinding() { return m_pPathfinding; }
 };
 
 #endif
\ No newline at end of file
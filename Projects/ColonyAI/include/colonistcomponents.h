@@ -0,0 +1,306 @@
+#pragma once
+#ifndef COLONISTCOMPONENTS_H
+#define COLONISTCOMPONENTS_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <memory>
+#include <vector>
+#include "memory.h"
+#include "needs.h"
+#include "path.h"
+#include "span.h"
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for the simulation data of every Colonist, packed by component
+///
+/// Each Colonist reads and writes its data through a slot, so systems can
+/// run over one component of every Colonist in a single pass. A Colonist
+/// keeps its data in a store of its own until it's added to an Environment,
+/// which moves it into the Environment's store at the slot matching the
+/// Colonist's index there.
+///
+/// Memories are held by value in one vector, each Colonist's in a span of
+/// it with room to grow. A span that runs out of room moves to the end of
+/// the vector with twice the room, and the spans are packed together again
+/// once more than half the vector is left behind by moves.
+///
+/////////////////////////////////////////////////
+class ColonistComponents
+{
+private:
+
+	std::vector<Needs> m_needs; //!< Hunger and Thirst of each Colonist
+	std::vector<float> m_birthCooldowns; //!< Reproduction cooldown of each Colonist in seconds
+	std::vector<unsigned char> m_alive; //!< Whether each Colonist was alive at the end of its last update
+	std::vector<sf::Vector2f> m_positions; //!< In-world coordinates of each Colonist
+	std::vector<float> m_speeds; //!< Speed each Colonist moves at per second
+	std::vector<sf::Vector2f> m_movedFrom; //!< Position of each Colonist before the movement system last ran over it
+	std::vector<unsigned char> m_reachedWaypoint; //!< Whether each Colonist reached a waypoint the last time the movement system ran over it
+	std::vector<Memory> m_memories; //!< Memories of every Colonist, each Colonist's in a span
+	std::vector<unsigned int> m_memoryOffsets; //!< Index of the first Memory in each Colonist's span
+	std::vector<unsigned int> m_memoryCounts; //!< Number of Memories in each Colonist's span
+	std::vector<unsigned int> m_memoryCapacities; //!< Room for Memories in each Colonist's span
+	unsigned int m_uiUnusedMemories = 0; //!< Room left behind by spans that moved, reclaimed by packing the spans
+	std::shared_ptr<std::vector<Path>> m_pPaths = std::shared_ptr<std::vector<Path>>(new std::vector<Path>()); //!< Route each Colonist is following, shared with its Pathfinding which plans it
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gives a Colonist's span of Memories twice the room, moving it to the end of the vector if it can't grow in place
+	///
+	/// \param kuiSlot Slot of the Colonist
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void growMemories(const unsigned int kuiSlot);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Packs the spans of Memories together in slot order, reclaiming the room left behind by moves
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void packMemories();
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Default Constructor
+	///
+	/////////////////////////////////////////////////
+	ColonistComponents() {}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a Colonist's components, with no path or Memories
+	///
+	/// \param kNeeds Starting Hunger and Thirst
+	/// \param kfBirthCooldown Starting reproduction cooldown in seconds
+	/// \param kPosition Starting position
+	/// \param kfSpeed Speed the Colonist moves at per second
+	///
+	/// \return Slot of the new Colonist
+	///
+	/////////////////////////////////////////////////
+	unsigned int add(const Needs& kNeeds, const float kfBirthCooldown, const sf::Vector2f kPosition, const float kfSpeed);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Moves a Colonist's components out of another store into a new slot
+	///
+	/// \param other Store holding the Colonist's components
+	/// \param kuiSlot Slot of the Colonist in the other store
+	///
+	/// \return Slot of the Colonist in this store
+	///
+	/////////////////////////////////////////////////
+	unsigned int take(ColonistComponents& other, const unsigned int kuiSlot);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the number of Colonists with components
+	///
+	/// \return Slot count
+	///
+	/////////////////////////////////////////////////
+	unsigned int size() const { return (unsigned int)m_needs.size(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns a Colonist's needs
+	///
+	/// \param kuiSlot Slot of the Colonist
+	///
+	/// \return The Hunger and Thirst data by reference
+	///
+	/////////////////////////////////////////////////
+	Needs& getNeeds(const unsigned int kuiSlot) { return m_needs[kuiSlot]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns a Colonist's needs
+	///
+	/// \param kuiSlot Slot of the Colonist
+	///
+	/// \return The Hunger and Thirst data by const reference
+	///
+	/////////////////////////////////////////////////
+	const Needs& getNeeds(const unsigned int kuiSlot) const { return m_needs[kuiSlot]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns a Colonist's position
+	///
+	/// \param kuiSlot Slot of the Colonist
+	///
+	/// \return In-world coordinates by reference
+	///
+	/////////////////////////////////////////////////
+	sf::Vector2f& getPosition(const unsigned int kuiSlot) { return m_positions[kuiSlot]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns a Colonist's position
+	///
+	/// \param kuiSlot Slot of the Colonist
+	///
+	/// \return In-world coordinates by const reference
+	///
+	/////////////////////////////////////////////////
+	const sf::Vector2f& getPosition(const unsigned int kuiSlot) const { return m_positions[kuiSlot]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the first of a run of positions, which only moves when a Colonist is added
+	///
+	/// \return Pointer to the position in slot 0
+	///
+	/////////////////////////////////////////////////
+	const sf::Vector2f* getPositionData() const { return m_positions.data(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns a Colonist's position before the movement system last ran over it
+	///
+	/// \param kuiSlot Slot of the Colonist
+	///
+	/// \return In-world coordinates
+	///
+	/////////////////////////////////////////////////
+	sf::Vector2f getMovedFrom(const unsigned int kuiSlot) const { return m_movedFrom[kuiSlot]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether a Colonist reached a waypoint the last time the movement system ran over it
+	///
+	/// \param kuiSlot Slot of the Colonist
+	///
+	/// \return Whether a waypoint was reached and removed from its path
+	///
+	/////////////////////////////////////////////////
+	bool reachedWaypoint(const unsigned int kuiSlot) const { return m_reachedWaypoint[kuiSlot] != 0; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns a Colonist's Memories
+	///
+	/// \param kuiSlot Slot of the Colonist
+	///
+	/// \return Span of the Memories, valid until Memories are next added
+	///
+	/////////////////////////////////////////////////
+	Span<Memory> getMemories(const unsigned int kuiSlot)
+	{
+		Memory* pFirst = m_memories.data() + m_memoryOffsets[kuiSlot];
+		return Span<Memory>(pFirst, pFirst + m_memoryCounts[kuiSlot]);
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns a Colonist's Memories
+	///
+	/// \param kuiSlot Slot of the Colonist
+	///
+	/// \return Span of the Memories as const, valid until Memories are next added
+	///
+	/////////////////////////////////////////////////
+	Span<const Memory> getMemories(const unsigned int kuiSlot) const
+	{
+		const Memory* kpFirst = m_memories.data() + m_memoryOffsets[kuiSlot];
+		return Span<const Memory>(kpFirst, kpFirst + m_memoryCounts[kuiSlot]);
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a Memory to the end of a Colonist's span, which moves every span when the vector grows
+	///
+	/// \param kuiSlot Slot of the Colonist
+	/// \param kMemory Memory to add, copied before anything moves
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void addMemory(const unsigned int kuiSlot, const Memory kMemory);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the routes of every Colonist, for each Colonist's Pathfinding to plan its own in
+	///
+	/// \return Paths by slot
+	///
+	/////////////////////////////////////////////////
+	std::shared_ptr<std::vector<Path>> getPaths() { return m_pPaths; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns a Colonist's reproduction cooldown
+	///
+	/// \param kuiSlot Slot of the Colonist
+	///
+	/// \return Seconds until the Colonist can reproduce
+	///
+	/////////////////////////////////////////////////
+	float getBirthCooldown(const unsigned int kuiSlot) const { return m_birthCooldowns[kuiSlot]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Sets a Colonist's reproduction cooldown
+	///
+	/// \param kuiSlot Slot of the Colonist
+	/// \param kfCooldown Seconds until the Colonist can reproduce
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void setBirthCooldown(const unsigned int kuiSlot, const float kfCooldown) { m_birthCooldowns[kuiSlot] = kfCooldown; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Sets whether a Colonist is alive, which decides whether its needs grow
+	///
+	/// \param kuiSlot Slot of the Colonist
+	/// \param kbAlive Whether the Colonist is alive
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void setAlive(const unsigned int kuiSlot, const bool kbAlive) { m_alive[kuiSlot] = kbAlive ? 1 : 0; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Needs system: grows the Hunger and Thirst and counts down the reproduction cooldown of living Colonists
+	///
+	/// \param kuiFirst Slot of the first Colonist to update
+	/// \param kuiEnd Slot after the last Colonist to update
+	/// \param kfElapsedTime The time passed since last update in seconds
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void updateNeeds(const unsigned int kuiFirst, const unsigned int kuiEnd, const float kfElapsedTime);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Movement system: moves Colonists toward the next waypoint of their paths, removing it once reached
+	///
+	/// Records where each Colonist moved from and whether it reached a
+	/// waypoint, for the Environment to move it between spatial hash buckets
+	/// and its Pathfinding to refine the next leg.
+	///
+	/// \param kuiFirst Slot of the first Colonist to move
+	/// \param kuiEnd Slot after the last Colonist to move
+	/// \param kfElapsedTime The time passed since last update in seconds
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void updateMovement(const unsigned int kuiFirst, const unsigned int kuiEnd, const float kfElapsedTime);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,157 @@
+#pragma once
+#ifndef DSTARLITE_H
+#define DSTARLITE_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <memory>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "cellgrid.h"
+#include "navgrid.h"
+#include "node.h"
+#include "nodeheap.h"
+#include "utils.h"
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for incremental replanning with D* Lite
+///
+/// The search runs backward from a goal Node and keeps its state between
+/// calls. While the goal stays the same, Nodes that become inaccessible
+/// only update the costs around them and the search resumes from there,
+/// rather than planning again from nothing.
+///
+/////////////////////////////////////////////////
+class DStarLite
+{
+private:
+
+	std::shared_ptr<NavGrid> m_pGrid; //!< Grid of Nodes searched over
+
+	unsigned int m_uiGoal = g_kuiNoNode; //!< Index of the Node being planned to, g_kuiNoNode before the first plan
+	unsigned int m_uiStart = g_kuiNoNode; //!< Index of the Node last planned from
+
+	float m_fKeyModifier = 0.0f; //!< Amount added to keys as the start moves, so the open list needn't be reordered
+
+	std::vector<float> m_fG; //!< Cost to the goal from each Node as last expanded
+	std::vector<float> m_fRhs; //!< Cost to the goal from each Node looking one step ahead
+
+	NodeHeap m_openNodes; //!< Nodes whose G and Rhs differ, ordered by key
+
+	unsigned int m_uiExpansions = 0; //!< Count of Nodes expanded by plans
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines the straight line distance between two Nodes
+	///
+	/// \param kuiNodeA Index of a Node
+	/// \param kuiNodeB Index of another Node
+	///
+	/// \return Distance between the Nodes
+	///
+	/////////////////////////////////////////////////
+	float heuristic(const unsigned int kuiNodeA, const unsigned int kuiNodeB) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines the cost of stepping between two neighbouring Nodes
+	///
+	/// \param kuiFrom Index of the Node stepped from
+	/// \param kuiTo Index of the Node stepped to
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return Cost of the step, infinity if it's blocked
+	///
+	/////////////////////////////////////////////////
+	float cost(const unsigned int kuiFrom, const unsigned int kuiTo, const CellGrid& kCells) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Recalculates a Node's Rhs and places it on or off the open list
+	///
+	/// \param kuiNode Index of the Node
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void updateNode(const unsigned int kuiNode, const CellGrid& kCells);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Expands Nodes until the cost from the start is known
+	///
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void computePath(const CellGrid& kCells);
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param pGrid Grid of Nodes to search over
+	///
+	/////////////////////////////////////////////////
+	DStarLite(std::shared_ptr<NavGrid> pGrid);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Plans from a start to a goal, reusing the last plan if the goal is the same
+	///
+	/// \param kuiStart Index of the Node to plan from
+	/// \param kuiGoal Index of the Node to plan to
+	/// \param kChanged Indices of Nodes whose accessibility changed since the last plan
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return Indices of the Nodes from start to goal, empty if the goal can't be reached
+	///
+	/////////////////////////////////////////////////
+	std::vector<unsigned int> plan(const unsigned int kuiStart, const unsigned int kuiGoal, const std::vector<unsigned int>& kChanged, const CellGrid& kCells);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Forgets the last plan, keeping the storage sized for the grid
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void reset() { m_uiGoal = g_kuiNoNode; m_uiStart = g_kuiNoNode; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the Node being planned to
+	///
+	/// \return Index of the goal Node, g_kuiNoNode before the first plan
+	///
+	/////////////////////////////////////////////////
+	unsigned int getGoal() const { return m_uiGoal; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of Nodes expanded by plans so far
+	///
+	/// \return Expansion count
+	///
+	/////////////////////////////////////////////////
+	unsigned int getExpansions() const { return m_uiExpansions; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the memory held by the search state
+	///
+	/// \return Size in bytes
+	///
+	/////////////////////////////////////////////////
+	size_t getMemoryUsage() const { return ((m_fG.capacity() + m_fRhs.capacity()) * sizeof(float)) + m_openNodes.getMemoryUsage(); }
+};
+
+#endif
\ No newline at end of file
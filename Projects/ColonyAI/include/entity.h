@@ -25,7 +25,8 @@ protected:
 
 	std::shared_ptr<Environment> m_pEnvironment; //!< Pointer to the Environment the Entity is within
 
-	sf::Vector2f m_position; //!< In-world coordinates
+	sf::Vector2f m_position; //!< In-world coordinates, unless a subclass keeps its own
+	sf::Vector2f* m_pPosition = &m_position; //!< Where the in-world coordinates are kept, pointed at a subclass's own if it keeps them
 	float m_fRadius; //!< Radial size of the Entity
 
 public:
@@ -71,7 +72,7 @@ public:
 	/// \return void
 	///
 	///////////////////////////////////////////////// 
-	void setPosition(const sf::Vector2f kPosition) { m_position = kPosition; }
+	void setPosition(const sf::Vector2f kPosition) { *m_pPosition = kPosition; }
 
 	/////////////////////////////////////////////////
 	///
@@ -80,7 +81,7 @@ public:
 	/// \return The Entity position vector
 	///
 	///////////////////////////////////////////////// 
-	sf::Vector2f getPosition() { return m_position; }
+	sf::Vector2f getPosition() { return *m_pPosition; }
 	
 	/////////////////////////////////////////////////
 	///
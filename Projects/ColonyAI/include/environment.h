@@ -10,6 +10,7 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <map>
 
 #include "object.h"
 #include "bush.h"
@@ -20,8 +21,28 @@
 #include "entity.h"
 #include "colonist.h"
 
+#include "navgrid.h"
+#include "bufferpool.h"
+#include "dstarlite.h"
+#include "searchbuffer.h"
+#include "flowfield.h"
+#include "pathcache.h"
+#include "landmarks.h"
+#include "pathservice.h"
+#include "spatialhash.h"
+#include "indexedview.h"
+#include "objecthandle.h"
+#include "colonistcomponents.h"
+#include "workerpool.h"
+
 class Entity;
 class Object;
+class Bush;
+class Rock;
+class Tree;
+class Water;
+class Colonist;
+class Food;
 
 /////////////////////////////////////////////////
 ///
@@ -38,6 +59,44 @@ private:
 	std::vector<std::shared_ptr<Entity>> m_pEntities; //!< Vector of Entity pointers to associated Entities in the Environment
 	std::vector<std::shared_ptr<Object>> m_pObjects; //!< Vector of Object pointers to associated Objects in the Environment
 
+	std::vector<std::shared_ptr<Bush>> m_pBushes; //!< The Bush Objects, kept as they're added
+	std::vector<std::shared_ptr<Rock>> m_pRocks; //!< The Rock Objects, kept as they're added
+	std::vector<std::shared_ptr<Tree>> m_pTrees; //!< The Tree Objects, kept as they're added
+	std::vector<std::shared_ptr<Water>> m_pWaters; //!< The Water Objects, kept as they're added
+	std::vector<std::shared_ptr<Colonist>> m_pColonists; //!< The Colonist Entities, kept as they're added
+	std::vector<std::shared_ptr<Food>> m_pFoods; //!< The Food Entities, kept as they're added
+	std::vector<ObjectHandle> m_objectHandles; //!< Typed store and index of each Object in m_pObjects
+
+	std::shared_ptr<ColonistComponents> m_pColonistComponents = std::shared_ptr<ColonistComponents>(new ColonistComponents()); //!< Packed needs, cooldowns, positions, paths and Memories of the Colonists, which systems update together
+	sf::Vector2f m_sourceSum; //!< Sum of the positions of every Bush and Water Object
+	unsigned int m_uiSourceCount = 0; //!< Count of Bush and Water Objects
+	std::shared_ptr<WorkerPool> m_pWorkerPool; //!< Threads the Colonists decide on, null when they decide on the update thread
+	const unsigned int m_kuiMinSharedWave = 32; //!< Fewest Colonists in a wave worth waking the worker threads for
+
+	float m_fNodeDiameter = 20.0f; //!< Diameter of the NavGrid Nodes, set by the 'n' value of the Environment line
+	std::shared_ptr<NavGrid> m_pNavGrid; //!< Grid of Nodes shared by every Pathfinding in the Environment
+	std::shared_ptr<FlowFieldCache> m_pFlowFields; //!< Flow fields shared by every Pathfinding in the Environment
+	CellGrid m_staticCells; //!< Inaccessible bit of each Node every Object's footprint covers, which shared flow fields are computed with
+	unsigned long long m_ullStaticKnowledge = 0; //!< Key of the Nodes every Object's footprint covers
+	std::shared_ptr<PathCache> m_pPathCache; //!< Recently created paths shared by every Pathfinding in the Environment
+	std::shared_ptr<BufferPool<DStarLite>> m_pReplanners; //!< Replanners lent to each Pathfinding repairing a path
+	std::shared_ptr<BufferPool<SearchBuffer>> m_pSliceBuffers; //!< Search buffers lent to each Pathfinding running a time-sliced search
+	std::shared_ptr<Landmarks> m_pLandmarks; //!< Landmark distance tables for the ALT heuristic, built once the Environment is loaded
+
+	const unsigned int m_kuiLandmarkCount = 8; //!< Number of landmarks picked
+
+	const float m_kfColonistRadius = 7.5f; //!< Radius of a Colonist, which the footprints and landmark tables are built for
+	std::map<const Object*, std::vector<unsigned int>> m_footprints; //!< Nodes a Colonist can't stand on because of each Object, built at load
+	std::shared_ptr<PathService> m_pPathService; //!< Worker threads solving path requests for every Pathfinding in the Environment, null when searches are time-sliced
+
+	const float m_kfBucketSize = 125.0f; //!< Width and height of the spatial hash buckets, near the Colonist vision radius
+	std::shared_ptr<SpatialHash> m_pObjectHash; //!< Buckets of the Objects by position, for finding those near a point
+	std::shared_ptr<SpatialHash> m_pEntityHash; //!< Buckets of the Entities by position, kept up to date as they move
+	std::map<const Entity*, unsigned int> m_entityIndices; //!< Index of each Entity in m_pEntities, for moving it between buckets
+
+	const unsigned int m_kuiExpansionBudget = 2000; //!< Nodes time-sliced searches may expand per update, shared by every Pathfinding
+	unsigned int m_uiExpansionsLeft = 2000; //!< Nodes time-sliced searches may still expand this update
+
 	/////////////////////////////////////////////////
 	///
 	/// \brief Draws the Environment to the RenderTarget
@@ -83,6 +142,73 @@ private:
 	///////////////////////////////////////////////// 
 	void readEntityLine(std::istringstream& iss);
 
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds an Object to the Environment, after it's been added to its typed store
+	///
+	/// \param pObject The Object to add
+	/// \param kuiStoreIndex Index of the Object in its typed store
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void storeObject(std::shared_ptr<Object> pObject, const unsigned int kuiStoreIndex);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds an Entity to the Environment, after it's been added to its typed store
+	///
+	/// \param pEntity The Entity to add
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void storeEntity(std::shared_ptr<Entity> pEntity);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Finds the Objects of a certain type that may reach within a radius of a point
+	///
+	/// \param kPosition Centre of the circle
+	/// \param kfRadius Radius of the circle
+	/// \param kType Type of Object to find
+	/// \param indices Vector to fill with the indices of the Objects found in their typed store
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void findObjectsNear(const sf::Vector2f kPosition, const float kfRadius, const ObjectType kType, std::vector<unsigned int>& indices);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Has a range of Colonists perceive and decide, spread over the worker threads
+	///
+	/// Every Colonist perceives before any decides, with what they perceived
+	/// added to the Memories in order between, as adding can move every
+	/// Colonist's Memories.
+	///
+	/// \param kuiFirst Index of the first Colonist
+	/// \param kuiEnd Index after the last Colonist
+	/// \param klTime The current time, stamped on the Colonists' Memories
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void decideColonists(const unsigned int kuiFirst, const unsigned int kuiEnd, const long klTime);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Runs a task for a range of Colonists, spread over the worker threads when there are enough
+	///
+	/// \param kuiFirst Index of the first Colonist
+	/// \param kuiEnd Index after the last Colonist
+	/// \param kTask Task to run with each Colonist's index from the first
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void runColonists(const unsigned int kuiFirst, const unsigned int kuiEnd, const std::function<void(const unsigned int)>& kTask);
+
 protected:
 	
 public:
@@ -105,10 +231,33 @@ public:
 	///////////////////////////////////////////////// 
 	bool loadFromFile(const std::string ksFilePath);
 
+	/////////////////////////////////////////////////
+	///
+	/// \brief Loads Env data from a stream of Env file lines
+	///
+	/// Entity lines are read last, once the footprints and landmark tables
+	/// are built, so every Colonist's Pathfinding is created with them.
+	///
+	/// \param envStream The lines to load, as an Env file would hold them
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void loadFromStream(std::istream& envStream);
+
 	/////////////////////////////////////////////////
 	///
 	/// \brief Updates the Environment and its contents with elapsed time
 	///
+	/// Each wave of Colonists first perceives and decides in parallel, only
+	/// reading the Environment: each picks its state, plans its path and
+	/// marks the Nodes it learns are inaccessible. The wave then updates one
+	/// at a time in order, committing births, Memory sharing and path
+	/// requests, and the movement system moves the whole wave along their
+	/// paths. Decisions don't depend on the number of threads, but a
+	/// path requested from the path workers is only followed from the
+	/// first update after it's solved, which nothing waits for.
+	///
 	/// \param kfElapsedTime The time passed since last update in seconds
 	///
 	/// \return void
@@ -116,6 +265,21 @@ public:
 	///////////////////////////////////////////////// 
 	void update(const float kfElapsedTime);
 
+	/////////////////////////////////////////////////
+	///
+	/// \brief Sets the number of threads the Environment updates with
+	///
+	/// The threads beside the update thread are split between the path
+	/// request workers, which take half rounded up, and the workers the
+	/// Colonists decide on. Requests still pending are solved first.
+	///
+	/// \param kuiThreads Thread count including the update thread, 1 or less decides and time-slices searches on the update thread alone
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void setUpdateThreads(const unsigned int kuiThreads);
+
 	/////////////////////////////////////////////////
 	///
 	/// \brief Returns the Environment size
@@ -127,93 +291,355 @@ public:
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Returns the Environment Object member
+	/// \brief Returns the Environment NavGrid
 	///
-	/// \return The vector of Objects
+	/// \return The grid of Nodes shared by every Pathfinding
 	///
 	///////////////////////////////////////////////// 
-	std::vector<std::shared_ptr<Object>> getObjects() { return m_pObjects; }
+	std::shared_ptr<NavGrid> getNavGrid() { return m_pNavGrid; }
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Returns the Environment Objects of a certain type
+	/// \brief Returns the Environment flow field cache
+	///
+	/// \return The flow fields shared by every Pathfinding
+	///
+	///////////////////////////////////////////////// 
+	std::shared_ptr<FlowFieldCache> getFlowFields() { return m_pFlowFields; }
+
+	/////////////////////////////////////////////////
 	///
-	/// \param kType Type of Object to return
+	/// \brief Returns the Nodes every Object's footprint covers
 	///
-	/// \return The vector of Objects that match the given type
+	/// \return Inaccessible bit of each Node, empty before the Environment is loaded
 	///
 	///////////////////////////////////////////////// 
-	std::vector<std::shared_ptr<Object>> getObjects(const ObjectType kType)
-	{
-		// Defines vector for result
-		std::vector<std::shared_ptr<Object>> result;
+	const CellGrid& getStaticCells() const { return m_staticCells; }
 
-		// For all Objects
-		for (std::shared_ptr<Object> pObject : m_pObjects)
-		{
-			// If Object's type matches kType
-			if (pObject->getType() == kType)
-			{
-				result.push_back(pObject); // Pushes Object onto result vector
-			}
-		}
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the key of the Nodes every Object's footprint covers
+	///
+	/// \return Knowledge key the shared flow fields are computed with
+	///
+	///////////////////////////////////////////////// 
+	unsigned long long getStaticKnowledge() const { return m_ullStaticKnowledge; }
 
-		return result;
-	}
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Environment path cache
+	///
+	/// \return The recently created paths shared by every Pathfinding
+	///
+	///////////////////////////////////////////////// 
+	std::shared_ptr<PathCache> getPathCache() { return m_pPathCache; }
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Returns the Environment Object vector
+	/// \brief Returns the Environment replanners
 	///
-	/// \return Object vector by reference
+	/// \return The replanners lent to Pathfindings repairing a path
 	///
 	///////////////////////////////////////////////// 
-	std::vector<std::shared_ptr<Object>>* getObjectVec() { return &m_pObjects; }
+	std::shared_ptr<BufferPool<DStarLite>> getReplanners() { return m_pReplanners; }
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Returns the Environment Entity member
+	/// \brief Returns the Environment time-sliced search buffers
+	///
+	/// \return The search buffers lent to Pathfindings running a time-sliced search
+	///
+	///////////////////////////////////////////////// 
+	std::shared_ptr<BufferPool<SearchBuffer>> getSliceBuffers() { return m_pSliceBuffers; }
+
+	/////////////////////////////////////////////////
 	///
-	/// \return The vector of Entities
+	/// \brief Returns the Environment landmark tables
+	///
+	/// \return The landmark distance tables, nullptr before the Environment is loaded
+	///
+	///////////////////////////////////////////////// 
+	std::shared_ptr<Landmarks> getLandmarks() { return m_pLandmarks; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the store of the Colonists' components
+	///
+	/// \return The packed components of every Colonist
 	///
 	///////////////////////////////////////////////// 
-	std::vector<std::shared_ptr<Entity>> getEntities() { return m_pEntities; }
+	std::shared_ptr<ColonistComponents> getColonistComponents() { return m_pColonistComponents; }
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Returns the Environment Entities of a certain type
+	/// \brief Returns the Colonists' 'home' position
 	///
-	/// \param kType Type of Entity to return
+	/// Objects don't move, so it's kept up to date as they're added.
 	///
-	/// \return The vector of Entities that match the given type
+	/// \return The average position of every Bush and Water Object, 0,0 if there are none
 	///
 	///////////////////////////////////////////////// 
-	std::vector<std::shared_ptr<Entity>> getEntities(const EntityType kType)
-	{
-		// Defines vector for result
-		std::vector<std::shared_ptr<Entity>> result;
+	sf::Vector2f getHomePosition() { return (m_uiSourceCount == 0) ? sf::Vector2f(0.0f, 0.0f) : m_sourceSum / (float)m_uiSourceCount; }
 
-		// For all Objects
-		for (std::shared_ptr<Entity> pEntity : m_pEntities)
-		{
-			// If Entity's type matches kType
-			if (pEntity->getType() == kType)
-			{
-				result.push_back(pEntity); // Pushes Entity onto result vector
-			}
-		}
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the radius of a Colonist the footprints are built for
+	///
+	/// \return The Colonist radius
+	///
+	///////////////////////////////////////////////// 
+	float getColonistRadius() { return m_kfColonistRadius; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Nodes a Colonist can't stand on because of an Object
+	///
+	/// Objects don't move, so each footprint is worked out once and shared
+	/// by every Pathfinding. Objects added after loading get theirs as
+	/// they're added, so Colonists deciding in parallel only read them.
+	///
+	/// \param kpObject The Object
+	///
+	/// \return Indices of the Nodes in ascending order
+	///
+	///////////////////////////////////////////////// 
+	const std::vector<unsigned int>& getFootprint(const std::shared_ptr<Object> kpObject);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Environment path request service
+	///
+	/// \return The worker threads solving path requests, null when searches are time-sliced instead
+	///
+	///////////////////////////////////////////////// 
+	std::shared_ptr<PathService> getPathService() { return m_pPathService; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns how many Nodes time-sliced searches may still expand this update
+	///
+	/// \return The expansions left in the update's budget
+	///
+	///////////////////////////////////////////////// 
+	unsigned int getExpansionsLeft() { return m_uiExpansionsLeft; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Takes expansions made by a time-sliced search from the update's budget
+	///
+	/// \param kuiExpansions Number of Nodes expanded
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void spendExpansions(const unsigned int kuiExpansions) { m_uiExpansionsLeft = (kuiExpansions < m_uiExpansionsLeft) ? m_uiExpansionsLeft - kuiExpansions : 0; }
 
-		return result;
-	}
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a Bush to the Environment
+	///
+	/// \param pObject The Bush to add
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void addObject(std::shared_ptr<Bush> pObject);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a Rock to the Environment
+	///
+	/// \param pObject The Rock to add
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void addObject(std::shared_ptr<Rock> pObject);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a Tree to the Environment
+	///
+	/// \param pObject The Tree to add
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void addObject(std::shared_ptr<Tree> pObject);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a Water to the Environment
+	///
+	/// \param pObject The Water to add
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void addObject(std::shared_ptr<Water> pObject);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a Colonist to the Environment
+	///
+	/// \param pEntity The Colonist to add
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void addEntity(std::shared_ptr<Colonist> pEntity);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a Food to the Environment
+	///
+	/// \param pEntity The Food to add
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void addEntity(std::shared_ptr<Food> pEntity);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Moves an Entity to the spatial hash bucket of its current position
+	///
+	/// Called by an Entity whenever its position changes.
+	///
+	/// \param kpEntity The Entity that moved
+	/// \param kFrom Position of the Entity before it moved
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void moveEntity(const Entity* kpEntity, const sf::Vector2f kFrom);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Objects that may reach within a radius of a point
+	///
+	/// Only the spatial hash buckets the circle overlaps are visited, so
+	/// some Objects just outside it may be returned too.
+	///
+	/// \param kPosition Centre of the circle
+	/// \param kfRadius Radius of the circle
+	/// \param indices Vector to hold the indices of the Objects found, reused by the caller between queries
+	///
+	/// \return View of the Objects, in the order of the Environment's Objects, valid until indices changes
+	///
+	///////////////////////////////////////////////// 
+	IndexedView<Object> getObjectsNear(const sf::Vector2f kPosition, const float kfRadius, std::vector<unsigned int>& indices);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Bushes that may reach within a radius of a point
+	///
+	/// \param kPosition Centre of the circle
+	/// \param kfRadius Radius of the circle
+	/// \param indices Vector to hold the indices of the Bushes found, reused by the caller between queries
+	///
+	/// \return View of the Bushes, in the order they were added, valid until indices changes
+	///
+	///////////////////////////////////////////////// 
+	IndexedView<Bush> getBushesNear(const sf::Vector2f kPosition, const float kfRadius, std::vector<unsigned int>& indices);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Water Objects that may reach within a radius of a point
+	///
+	/// \param kPosition Centre of the circle
+	/// \param kfRadius Radius of the circle
+	/// \param indices Vector to hold the indices of the Water Objects found, reused by the caller between queries
+	///
+	/// \return View of the Water Objects, in the order they were added, valid until indices changes
+	///
+	///////////////////////////////////////////////// 
+	IndexedView<Water> getWatersNear(const sf::Vector2f kPosition, const float kfRadius, std::vector<unsigned int>& indices);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Entities that may reach within a radius of a point
+	///
+	/// \param kPosition Centre of the circle
+	/// \param kfRadius Radius of the circle
+	/// \param indices Vector to hold the indices of the Entities found, reused by the caller between queries
+	///
+	/// \return View of the Entities, in the order of the Environment's Entities, valid until indices changes
+	///
+	///////////////////////////////////////////////// 
+	IndexedView<Entity> getEntitiesNear(const sf::Vector2f kPosition, const float kfRadius, std::vector<unsigned int>& indices);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Environment Object member
+	///
+	/// \return The vector of Objects by reference
+	///
+	///////////////////////////////////////////////// 
+	const std::vector<std::shared_ptr<Object>>& getObjects() const { return m_pObjects; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Environment Bushes
+	///
+	/// \return The vector of Bushes by reference
+	///
+	///////////////////////////////////////////////// 
+	const std::vector<std::shared_ptr<Bush>>& getBushes() const { return m_pBushes; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Environment Rocks
+	///
+	/// \return The vector of Rocks by reference
+	///
+	///////////////////////////////////////////////// 
+	const std::vector<std::shared_ptr<Rock>>& getRocks() const { return m_pRocks; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Environment Trees
+	///
+	/// \return The vector of Trees by reference
+	///
+	///////////////////////////////////////////////// 
+	const std::vector<std::shared_ptr<Tree>>& getTrees() const { return m_pTrees; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Environment Water Objects
+	///
+	/// \return The vector of Water Objects by reference
+	///
+	///////////////////////////////////////////////// 
+	const std::vector<std::shared_ptr<Water>>& getWaters() const { return m_pWaters; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Environment Entity member
+	///
+	/// \return The vector of Entities by reference
+	///
+	///////////////////////////////////////////////// 
+	const std::vector<std::shared_ptr<Entity>>& getEntities() const { return m_pEntities; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the Environment Colonists
+	///
+	/// \return The vector of Colonists by reference
+	///
+	///////////////////////////////////////////////// 
+	const std::vector<std::shared_ptr<Colonist>>& getColonists() const { return m_pColonists; }
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Returns the Environment Entity vector
+	/// \brief Returns the Environment Food Entities
 	///
-	/// \return Entity vector by reference
+	/// \return The vector of Food Entities by reference
 	///
 	///////////////////////////////////////////////// 
-	std::vector<std::shared_ptr<Entity>>* getEntityVec() { return &m_pEntities; }
+	const std::vector<std::shared_ptr<Food>>& getFoods() const { return m_pFoods; }
 };
 
 #endif
\ No newline at end of file
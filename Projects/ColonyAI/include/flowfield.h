@@ -0,0 +1,241 @@
+#pragma once
+#ifndef FLOWFIELD_H
+#define FLOWFIELD_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <memory>
+#include <vector>
+#include <queue>
+#include <map>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include "cellgrid.h"
+#include "navgrid.h"
+#include "node.h"
+#include "utils.h"
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for an integration field leading every Node to a target
+///
+/// The field holds the cost from each Node to the nearest seed Node
+/// around a target and the neighbour to step to next, so following it
+/// is O(1) per step. A field is computed against one set of known
+/// inaccessible Nodes and can be repaired when more become known.
+///
+/////////////////////////////////////////////////
+class FlowField
+{
+private:
+
+	std::shared_ptr<NavGrid> m_pGrid; //!< Grid of Nodes the field covers
+
+	sf::Vector2f m_targetPos; //!< Position of the target
+	float m_fTargetRadius; //!< Radius of the target
+
+	CellGrid m_cells; //!< Inaccessible bit of each Node the field was computed with
+	unsigned long long m_ullKnowledge; //!< Key of the inaccessible Nodes the field was computed with
+
+	std::vector<unsigned int> m_uiSeeds; //!< Indices of the Nodes the field leads to
+	std::vector<float> m_fCosts; //!< Cost from each Node to the nearest seed
+	std::vector<unsigned int> m_uiNext; //!< Index of the Node to step to next from each Node
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Spreads cheaper costs outward from queued Nodes
+	///
+	/// \param openNodes Queue of costs and Node indices to spread from
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void spread(std::priority_queue<std::pair<float, unsigned int>, std::vector<std::pair<float, unsigned int>>, std::greater<std::pair<float, unsigned int>>>& openNodes);
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param pGrid Grid of Nodes the field covers
+	/// \param kTargetPos Position of the target
+	/// \param kfTargetRadius Radius of the target
+	///
+	/////////////////////////////////////////////////
+	FlowField(std::shared_ptr<NavGrid> pGrid, const sf::Vector2f kTargetPos, const float kfTargetRadius);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Computes the whole field from a set of seed Nodes
+	///
+	/// \param kSeeds Indices of the Nodes to lead to
+	/// \param kCells Inaccessible bit of each Node
+	/// \param kullKnowledge Key of the inaccessible Nodes
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void integrate(const std::vector<unsigned int>& kSeeds, const CellGrid& kCells, const unsigned long long kullKnowledge);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Repairs the field for Nodes that have become inaccessible since it was computed
+	///
+	/// Only Nodes whose route passed through a newly inaccessible Node
+	/// are recomputed, the rest of the field is kept.
+	///
+	/// \param kCells Inaccessible bit of each Node, a superset of the field's
+	/// \param kullKnowledge Key of the inaccessible Nodes
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void repair(const CellGrid& kCells, const unsigned long long kullKnowledge);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether the field can be repaired to match a set of inaccessible Nodes
+	///
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return Whether every Node inaccessible to the field is still inaccessible
+	///
+	/////////////////////////////////////////////////
+	bool canRepairTo(const CellGrid& kCells) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the Node to step to next from a Node
+	///
+	/// \param kuiNode Index of the Node
+	///
+	/// \return Index of the next Node, g_kuiNoNode at a seed or where the target can't be reached
+	///
+	/////////////////////////////////////////////////
+	unsigned int nextStep(const unsigned int kuiNode) const { return m_uiNext[kuiNode]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether the target can be reached from a Node
+	///
+	/// \param kuiNode Index of the Node
+	///
+	/// \return Whether the Node leads to a seed
+	///
+	/////////////////////////////////////////////////
+	bool reaches(const unsigned int kuiNode) const { return m_fCosts[kuiNode] < std::numeric_limits<float>::infinity(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the seed Nodes of the field
+	///
+	/// \return Indices of the seed Nodes
+	///
+	/////////////////////////////////////////////////
+	const std::vector<unsigned int>& getSeeds() const { return m_uiSeeds; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the position of the target
+	///
+	/// \return Target position
+	///
+	/////////////////////////////////////////////////
+	sf::Vector2f getTargetPos() const { return m_targetPos; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the radius of the target
+	///
+	/// \return Target radius
+	///
+	/////////////////////////////////////////////////
+	float getTargetRadius() const { return m_fTargetRadius; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the key of the inaccessible Nodes the field was computed with
+	///
+	/// \return Knowledge key
+	///
+	/////////////////////////////////////////////////
+	unsigned long long getKnowledge() const { return m_ullKnowledge; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the memory held by the field
+	///
+	/// \return Size in bytes
+	///
+	/////////////////////////////////////////////////
+	size_t getMemoryUsage() const { return (m_uiSeeds.capacity() * sizeof(unsigned int)) + (m_fCosts.capacity() * sizeof(float)) + (m_uiNext.capacity() * sizeof(unsigned int)) + m_cells.getMemoryUsage(); }
+};
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for sharing FlowFields between every Pathfinding in an Environment
+///
+/// Fields are found by target and knowledge key, so Colonists that know
+/// of the same inaccessible Nodes share one field. The cache doesn't keep
+/// fields alive, a field is dropped once no Pathfinding holds it.
+///
+/////////////////////////////////////////////////
+class FlowFieldCache
+{
+private:
+
+	//!< Struct that holds the key a FlowField is found by
+	struct FieldKey
+	{
+		float m_fX; //!< Target x position
+		float m_fY; //!< Target y position
+		float m_fRadius; //!< Target radius
+		unsigned long long m_ullKnowledge; //!< Knowledge key
+
+		bool operator<(const FieldKey& kOther) const
+		{
+			if (m_fX != kOther.m_fX) return m_fX < kOther.m_fX;
+			if (m_fY != kOther.m_fY) return m_fY < kOther.m_fY;
+			if (m_fRadius != kOther.m_fRadius) return m_fRadius < kOther.m_fRadius;
+			return m_ullKnowledge < kOther.m_ullKnowledge;
+		}
+	};
+
+	std::map<FieldKey, std::weak_ptr<FlowField>> m_pFields; //!< Fields by target and knowledge
+
+	std::mutex m_mutex; //!< Guards the fields, found and added by Colonists deciding on any thread
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Finds a field for a target computed with the given knowledge
+	///
+	/// \param kTargetPos Position of the target
+	/// \param kfTargetRadius Radius of the target
+	/// \param kullKnowledge Key of the inaccessible Nodes
+	///
+	/// \return The field, nullptr if there is none
+	///
+	/////////////////////////////////////////////////
+	std::shared_ptr<FlowField> find(const sf::Vector2f kTargetPos, const float kfTargetRadius, const unsigned long long kullKnowledge);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a field so other Pathfinding can share it
+	///
+	/// \param kpField The field to add
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void insert(const std::shared_ptr<FlowField> kpField);
+};
+
+#endif
\ No newline at end of file
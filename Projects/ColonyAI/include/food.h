@@ -29,17 +29,6 @@ private:
 	///////////////////////////////////////////////// 
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
-	/////////////////////////////////////////////////
-	///
-	/// \brief Updates the Food with elapsed time
-	///
-	/// \param kfElapsedTime The time passed since last update in seconds
-	///
-	/// \return void
-	///
-	///////////////////////////////////////////////// 
-	void update(const float kfElapsedTime);
-
 protected:
 
 public:
@@ -53,6 +42,17 @@ public:
 	///
 	///////////////////////////////////////////////// 
 	Food(std::shared_ptr<Environment> pEnv, const sf::Vector2f kPosition);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Updates the Food with elapsed time
+	///
+	/// \param kfElapsedTime The time passed since last update in seconds
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void update(const float kfElapsedTime);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+#ifndef GRIDSEARCH_H
+#define GRIDSEARCH_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <iostream>
+#include <queue>
+#include <vector>
+#include <math.h>
+#include "cellgrid.h"
+#include "landmarks.h"
+#include "navgrid.h"
+#include "node.h"
+#include "searchbuffer.h"
+#include "utils.h"
+
+enum SearchStatus { SEARCHING, FOUND, FAILED }; //!< Enum for the progress of a search
+enum Heuristic { MANHATTAN, OCTILE, ALT }; //!< Enum for estimates of the distance left to a target
+
+const unsigned int g_kuiUnlimitedBudget = 0xFFFFFFFF; //!< Expansion budget for searches that run to the end
+
+/////////////////////////////////////////////////
+///
+/// \brief Base class for searches over the grid of Nodes
+///
+/// Holds what every search algorithm reads: the shared grid, the
+/// inaccessible Nodes known to the Pathfinding searching and the estimate
+/// of the distance left. A search is made for each path and only lives as
+/// long as the grid and cells it reads.
+///
+/////////////////////////////////////////////////
+class GridSearch
+{
+private:
+
+protected:
+
+	const NavGrid& m_kGrid; //!< Grid of Nodes searched over
+	const CellGrid& m_kCells; //!< Inaccessible bit of each Node, as far as the Pathfinding searching knows
+
+	Heuristic m_heuristic; //!< Estimate of the distance left
+	const Landmarks* m_kpLandmarks; //!< Landmark tables whose bounds are admissible, nullptr if there are none that are
+
+	std::ostream& m_log; //!< Stream progress is written to
+
+	unsigned int m_uiExpansions = 0; //!< Count of Nodes expanded by the search
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether the Node at an index is accessible
+	///
+	/// \param kuiIndex Index of the Node to check
+	///
+	/// \return Whether the Node is accessible
+	///
+	/////////////////////////////////////////////////
+	bool isAccessible(const unsigned int kuiIndex) const { return (kuiIndex < m_kCells.getNodeCount()) && (!m_kCells.isBlocked(kuiIndex)); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines whether the Node at a column and row can be walked on
+	///
+	/// \param kiX Column of the Node
+	/// \param kiY Row of the Node
+	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
+	///
+	/// \return Whether the Node is walkable
+	///
+	/////////////////////////////////////////////////
+	bool walkable(const int kiX, const int kiY, const bool kbIgnoreAccess) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Calculates G value of a Node
+	///
+	/// \param kBuffer The search state holding the current Node's G
+	/// \param kuiCurrentNode Index of the current Node to calculate G for
+	/// \param kuiTargetNode Index of the Node that proceeds the current Node in the path
+	///
+	/// \return The calculated G value
+	///
+	/////////////////////////////////////////////////
+	float calcG(const SearchBuffer& kBuffer, const unsigned int kuiCurrentNode, const unsigned int kuiTargetNode) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Detemines the distance from one Node to another with the manhattan algorithm
+	///
+	/// \param kuiStartNode Index of the Node to calculate distance from
+	/// \param kuiEndNode Index of the Node to calculate distance to
+	///
+	/// \return Distance to the end Node
+	///
+	/////////////////////////////////////////////////
+	float distance(const unsigned int kuiStartNode, const unsigned int kuiEndNode) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines the length of the shortest 8-way route from one Node to another, ignoring accessibility
+	///
+	/// \param kuiStartNode Index of the Node to calculate distance from
+	/// \param kuiEndNode Index of the Node to calculate distance to
+	///
+	/// \return Distance to the end Node
+	///
+	/////////////////////////////////////////////////
+	float octile(const unsigned int kuiStartNode, const unsigned int kuiEndNode) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Estimates the distance left from a Node to the target with the selected heuristic
+	///
+	/// ALT falls back to octile when ignoring accessibility, or when there
+	/// are no landmark tables whose bounds are admissible.
+	///
+	/// \param kuiNode Index of the Node to estimate from
+	/// \param kuiTarget Index of the target Node
+	/// \param kbIgnoreAccess Whether the search ignores Node (in)accessibility
+	///
+	/// \return Estimated distance to the target
+	///
+	/////////////////////////////////////////////////
+	float heuristic(const unsigned int kuiNode, const unsigned int kuiTarget, const bool kbIgnoreAccess) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Creates a queue of points from a given destination back to the current position
+	///
+	/// \param kBuffer The search state holding the Node parents
+	/// \param uiNode Index of the Node to queue a path back from
+	///
+	/// \return A queue of positions from destination back to current position
+	///
+	/////////////////////////////////////////////////
+	std::queue<sf::Vector2f> queuePath(const SearchBuffer& kBuffer, unsigned int uiNode) const;
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param kGrid Grid of Nodes to search over
+	/// \param kCells Inaccessible bit of each Node
+	/// \param kHeuristic Estimate of the distance left
+	/// \param kpLandmarks Landmark tables whose bounds are admissible, nullptr if there are none that are
+	/// \param log Stream to write progress to
+	///
+	/////////////////////////////////////////////////
+	GridSearch(const NavGrid& kGrid, const CellGrid& kCells, const Heuristic kHeuristic, const Landmarks* kpLandmarks, std::ostream& log);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the number of Nodes the search has expanded
+	///
+	/// \return Expansion count
+	///
+	/////////////////////////////////////////////////
+	unsigned int getExpansions() const { return m_uiExpansions; }
+};
+
+#endif
\ No newline at end of file
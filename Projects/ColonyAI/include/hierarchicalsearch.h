@@ -0,0 +1,63 @@
+#pragma once
+#ifndef HIERARCHICALSEARCH_H
+#define HIERARCHICALSEARCH_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <iostream>
+#include <queue>
+#include <vector>
+#include "cellgrid.h"
+#include "clustergraph.h"
+#include "navgrid.h"
+#include "node.h"
+#include "utils.h"
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for searching the grid over a graph of cluster entrances
+///
+/// Plans the route between entrances, then refines only the first leg to
+/// Nodes. The rest are left as waypoints, refined as they're reached.
+///
+/////////////////////////////////////////////////
+class HierarchicalSearch
+{
+private:
+
+	ClusterGraph& m_clusters; //!< Graph of cluster entrances, built by the first search over it
+	const NavGrid& m_kGrid; //!< Grid of Nodes searched over
+	const CellGrid& m_kCells; //!< Inaccessible bit of each Node, as far as the Pathfinding searching knows
+
+	std::ostream& m_log; //!< Stream progress is written to
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param clusters Graph of cluster entrances to search over
+	/// \param kGrid Grid of Nodes to search over
+	/// \param kCells Inaccessible bit of each Node
+	/// \param log Stream to write progress to
+	///
+	/////////////////////////////////////////////////
+	HierarchicalSearch(ClusterGraph& clusters, const NavGrid& kGrid, const CellGrid& kCells, std::ostream& log);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Creates a path to target Node over the cluster graph, refining only the first leg
+	///
+	/// \param kuiStart Index of the Node to route from
+	/// \param kuiTarget Index of the Node to route toward
+	///
+	/// \return A queue of points that represent a route, empty if there is none
+	///
+	/////////////////////////////////////////////////
+	std::queue<sf::Vector2f> search(const unsigned int kuiStart, const unsigned int kuiTarget);
+};
+
+#endif
\ No newline at end of file
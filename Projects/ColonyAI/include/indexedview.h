@@ -0,0 +1,133 @@
+#pragma once
+#ifndef INDEXEDVIEW_H
+#define INDEXEDVIEW_H
+
+// Imports
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for reading some of a vector's items in place
+///
+/// Holds references to the vector and to a list of indices into it, so
+/// iterating copies neither the items nor their shared_ptrs. The view is
+/// only valid while both are unchanged.
+///
+/////////////////////////////////////////////////
+template <typename T>
+class IndexedView
+{
+private:
+
+	const std::vector<std::shared_ptr<T>>& m_kItems; //!< Vector the indices point into
+	const std::vector<unsigned int>& m_kIndices; //!< Indices of the items in the view
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Class for stepping through the items in the view
+	///
+	/////////////////////////////////////////////////
+	class Iterator
+	{
+	private:
+
+		const std::shared_ptr<T>* m_kpItems; //!< First item of the vector
+		const unsigned int* m_kpIndex; //!< Index of the current item
+
+	protected:
+
+	public:
+
+		/////////////////////////////////////////////////
+		///
+		/// \brief Constructor
+		///
+		/// \param kpItems First item of the vector
+		/// \param kpIndex Index of the current item
+		///
+		/////////////////////////////////////////////////
+		Iterator(const std::shared_ptr<T>* kpItems, const unsigned int* kpIndex) : m_kpItems(kpItems), m_kpIndex(kpIndex) {}
+
+		/////////////////////////////////////////////////
+		///
+		/// \brief Returns the current item
+		///
+		/// \return The item by reference
+		///
+		/////////////////////////////////////////////////
+		const std::shared_ptr<T>& operator*() const { return m_kpItems[*m_kpIndex]; }
+
+		/////////////////////////////////////////////////
+		///
+		/// \brief Steps to the next item
+		///
+		/// \return This iterator
+		///
+		/////////////////////////////////////////////////
+		Iterator& operator++() { m_kpIndex++; return *this; }
+
+		/////////////////////////////////////////////////
+		///
+		/// \brief Returns whether two iterators are at different items
+		///
+		/// \param kOther The other iterator
+		///
+		/// \return Whether they differ
+		///
+		/////////////////////////////////////////////////
+		bool operator!=(const Iterator& kOther) const { return m_kpIndex != kOther.m_kpIndex; }
+	};
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param kItems Vector the indices point into
+	/// \param kIndices Indices of the items in the view
+	///
+	/////////////////////////////////////////////////
+	IndexedView(const std::vector<std::shared_ptr<T>>& kItems, const std::vector<unsigned int>& kIndices) : m_kItems(kItems), m_kIndices(kIndices) {}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the first item
+	///
+	/// \return Iterator at the first item
+	///
+	/////////////////////////////////////////////////
+	Iterator begin() const { return Iterator(m_kItems.data(), m_kIndices.data()); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns one past the last item
+	///
+	/// \return Iterator past the last item
+	///
+	/////////////////////////////////////////////////
+	Iterator end() const { return Iterator(m_kItems.data(), m_kIndices.data() + m_kIndices.size()); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the number of items in the view
+	///
+	/// \return Item count
+	///
+	/////////////////////////////////////////////////
+	unsigned int size() const { return (unsigned int)m_kIndices.size(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether the view has no items
+	///
+	/// \return Whether it's empty
+	///
+	/////////////////////////////////////////////////
+	bool empty() const { return m_kIndices.empty(); }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+#ifndef JUMPPOINTSEARCH_H
+#define JUMPPOINTSEARCH_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <iostream>
+#include <queue>
+#include <vector>
+#include "cellgrid.h"
+#include "gridsearch.h"
+#include "landmarks.h"
+#include "navgrid.h"
+#include "node.h"
+#include "searchbuffer.h"
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for searching the grid with Jump Point Search
+///
+/// Only the Nodes where the route can turn are added to the open list,
+/// the Nodes between them are jumped over in a straight line.
+///
+/////////////////////////////////////////////////
+class JumpPointSearch : public GridSearch
+{
+private:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Generates the jump points reachable from a Node
+	///
+	/// \param kuiParent Index of the Node's parent, g_kuiNoNode for the start Node
+	/// \param kuiNode Index of the Node to jump from
+	/// \param kuiTarget Index of the Node being routed toward
+	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
+	///
+	/// \return Indices of the jump points
+	///
+	/////////////////////////////////////////////////
+	std::vector<unsigned int> jumpSuccessors(const unsigned int kuiParent, const unsigned int kuiNode, const unsigned int kuiTarget, const bool kbIgnoreAccess) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Travels from a Node in a direction until a jump point is found
+	///
+	/// \param iX Column of the Node to travel from
+	/// \param iY Row of the Node to travel from
+	/// \param kiDX Column direction of travel
+	/// \param kiDY Row direction of travel
+	/// \param kuiTarget Index of the Node being routed toward
+	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
+	///
+	/// \return Index of the jump point, g_kuiNoNode if there is none
+	///
+	/////////////////////////////////////////////////
+	unsigned int jump(int iX, int iY, const int kiDX, const int kiDY, const unsigned int kuiTarget, const bool kbIgnoreAccess) const;
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param kGrid Grid of Nodes to search over
+	/// \param kCells Inaccessible bit of each Node
+	/// \param kHeuristic Estimate of the distance left
+	/// \param kpLandmarks Landmark tables whose bounds are admissible, nullptr if there are none that are
+	/// \param log Stream to write progress to
+	///
+	/////////////////////////////////////////////////
+	JumpPointSearch(const NavGrid& kGrid, const CellGrid& kCells, const Heuristic kHeuristic, const Landmarks* kpLandmarks, std::ostream& log);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Creates a path to target Node with Jump Point Search
+	///
+	/// \param buffer The search state, with the current Node visited and closed
+	/// \param uiCurrent Index of the Node the search starts at
+	/// \param kuiTarget Index of the Node to route toward
+	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
+	///
+	/// \return A queue of jump point positions that represent a route
+	///
+	/////////////////////////////////////////////////
+	std::queue<sf::Vector2f> search(SearchBuffer& buffer, unsigned int uiCurrent, const unsigned int kuiTarget, const bool kbIgnoreAccess);
+};
+
+#endif
\ No newline at end of file
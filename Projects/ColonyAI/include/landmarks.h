@@ -0,0 +1,126 @@
+#pragma once
+#ifndef LANDMARKS_H
+#define LANDMARKS_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <memory>
+#include <vector>
+#include <queue>
+#include <functional>
+#include <limits>
+#include "cellgrid.h"
+#include "navgrid.h"
+#include "node.h"
+#include "utils.h"
+
+const unsigned short g_kusUnreachable = 0xFFFF; //!< Landmark distance stored for Nodes the landmark can't reach
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for the landmark distance tables used by the ALT heuristic
+///
+/// Each landmark stores its path distance to every Node, in quarter
+/// pixels in 16 bits. By the triangle inequality, the difference between
+/// a landmark's distances to two Nodes is a lower bound on the path
+/// between them. The bound holds for any Pathfinding that knows at least
+/// the inaccessible Nodes the tables were built with, since knowing more
+/// only lengthens paths.
+///
+/////////////////////////////////////////////////
+class Landmarks
+{
+private:
+
+	std::shared_ptr<NavGrid> m_pGrid; //!< Grid of Nodes the tables cover
+
+	CellGrid m_cells; //!< Inaccessible bit of each Node the tables were built with
+
+	std::vector<unsigned int> m_uiLandmarks; //!< Indices of the landmark Nodes
+	std::vector<unsigned short> m_usDistances; //!< Distance from each landmark to each Node in quarter pixels, one row of Nodes per landmark
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines the path distance from a Node to every other Node
+	///
+	/// \param kuiSource Index of the Node to measure from
+	/// \param distances Vector to fill with each Node's distance, infinity if it can't be reached
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void spread(const unsigned int kuiSource, std::vector<float>& distances) const;
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor, chooses the landmarks and builds their tables
+	///
+	/// Landmarks are picked one at a time as the Node furthest from those
+	/// already picked, preferring Nodes none of them can reach.
+	///
+	/// \param pGrid Grid of Nodes to cover
+	/// \param kCells Inaccessible bit of each Node to build with
+	/// \param kuiCount Most landmarks to pick
+	///
+	/////////////////////////////////////////////////
+	Landmarks(std::shared_ptr<NavGrid> pGrid, const CellGrid& kCells, const unsigned int kuiCount);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines a lower bound on the path distance between two Nodes
+	///
+	/// \param kuiNode Index of a Node
+	/// \param kuiTarget Index of another Node
+	///
+	/// \return The largest bound any landmark gives, 0 if none reach both Nodes
+	///
+	/////////////////////////////////////////////////
+	float bound(const unsigned int kuiNode, const unsigned int kuiTarget) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether a Node was inaccessible when the tables were built
+	///
+	/// A Pathfinding counts the Nodes it marks that return true, and once it
+	/// has counted getBlockedCount of them its bounds are admissible.
+	///
+	/// \param kuiNode Index of the Node, must be within the grid
+	///
+	/// \return Whether the tables were built with the Node inaccessible
+	///
+	/////////////////////////////////////////////////
+	bool builtBlocked(const unsigned int kuiNode) const { return m_cells.isBlocked(kuiNode); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the count of Nodes inaccessible when the tables were built
+	///
+	/// \return Count of inaccessible Nodes
+	///
+	/////////////////////////////////////////////////
+	unsigned int getBlockedCount() const { return m_cells.getBlockedCount(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the landmark Nodes
+	///
+	/// \return Indices of the landmarks
+	///
+	/////////////////////////////////////////////////
+	const std::vector<unsigned int>& getLandmarks() const { return m_uiLandmarks; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the memory held by the distance tables
+	///
+	/// \return Size in bytes
+	///
+	/////////////////////////////////////////////////
+	size_t getMemoryUsage() const { return (m_usDistances.capacity() * sizeof(unsigned short)) + m_cells.getMemoryUsage(); }
+};
+
+#endif
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <SFML/System.hpp>
 #include <memory>
 #include "object.h"
+#include "span.h"
 
 class Object;
 
@@ -29,6 +30,13 @@ protected:
 
 public:
 
+	/////////////////////////////////////////////////
+	///
+	/// \brief Default Constructor, for room kept in a Colonist's span of Memories
+	///
+	///////////////////////////////////////////////// 
+	Memory() : m_lTime(0), m_type(NULL_OBJECT) {}
+
 	/////////////////////////////////////////////////
 	///
 	/// \brief Constructor
@@ -64,7 +72,7 @@ public:
 	/// \return The Memory time
 	///
 	///////////////////////////////////////////////// 
-	long getTime() { return m_lTime; }
+	long getTime() const { return m_lTime; }
 
 	/////////////////////////////////////////////////
 	///
@@ -84,33 +92,33 @@ public:
 	/// \return The Memory type
 	///
 	///////////////////////////////////////////////// 
-	MemoryType getType() { return m_type; }
+	MemoryType getType() const { return m_type; }
 
 	/////////////////////////////////////////////////
 	///
 	/// \brief Gets the Memory Object
 	///
-	/// \return The Memory Object
+	/// \return The Memory Object by reference
 	///
 	///////////////////////////////////////////////// 
-	std::shared_ptr<Object> getObject() { return m_pObject; }
+	const std::shared_ptr<Object>& getObject() const { return m_pObject; }
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Gets whether a vector of Memories contains a certain type
+	/// \brief Gets whether a span of Memories contains a certain type
 	///
 	/// \param kType Type to check for
-	/// \param kpMemories Memory vector to check within
+	/// \param kMemories Memories to check within
 	///
-	/// \return Whether the Memory vector contains a Memory of the given type
+	/// \return Whether the Memories contain a Memory of the given type
 	///
 	///////////////////////////////////////////////// 
-	static bool typeInMem(const MemoryType kType, const std::vector<std::shared_ptr<Memory>> kpMemories) 
+	static bool typeInMem(const MemoryType kType, const Span<const Memory> kMemories) 
 	{
-		// If a Type in the vector is the kType: Return True
-		for (std::shared_ptr<Memory> pMemory : kpMemories)
+		// If a Type in the span is the kType: Return True
+		for (const Memory& kMemory : kMemories)
 		{
-			if (pMemory->getType() == kType) return true;
+			if (kMemory.getType() == kType) return true;
 		}
 
 		// Return False: kType not found
@@ -0,0 +1,175 @@
+#pragma once
+#ifndef NAVGRID_H
+#define NAVGRID_H
+
+// Imports
+#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+#include <iostream>
+#include <vector>
+#include <math.h>
+#include <random>
+#include <atomic>
+#include "node.h"
+#include "utils.h"
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for the grid of Nodes shared by every Pathfinding in an Environment
+///
+/// The grid only holds topology: Node positions, stored flat and addressed
+/// by index. What each Colonist knows to be inaccessible is kept by its
+/// own Pathfinding.
+///
+/////////////////////////////////////////////////
+class NavGrid
+{
+private:
+
+	std::vector<sf::Vector2f> m_positions; //!< Position of each Node, indexed by Node index
+	std::vector<unsigned long long> m_keys; //!< Random key of each Node, combined to identify a set of Nodes
+
+	float m_fNodeDiameter; //!< Diameter of the Nodes
+	float m_fNodeRadius; //!< Radius of the Nodes
+
+	unsigned int m_uiNodeCols; //!< Count for required columns of Nodes
+	unsigned int m_uiNodeRows; //!< Count for required rows of Nodes
+
+	unsigned long long m_ullId; //!< Id of the grid, unique for the run even when a grid is allocated where a freed one was
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param kSize Size of the Environment to cover
+	/// \param kfNodeDiameter Diameter of the Nodes
+	///
+	/////////////////////////////////////////////////
+	NavGrid(const sf::Vector2u kSize, const float kfNodeDiameter);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Detemines the index of the Node that a given position falls within
+	///
+	/// \param kPosition Position to calculate a local Node with
+	///
+	/// \return Index of the Node at position, g_kuiNoNode if there is none
+	///
+	/////////////////////////////////////////////////
+	unsigned int indexFromPos(const sf::Vector2f kPosition) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the Node at a given index with error checks
+	///
+	/// \param kuiIndex Index to get the Node with
+	///
+	/// \return Node at index, invalid if the index is outside the grid
+	///
+	/////////////////////////////////////////////////
+	Node getNode(const unsigned int kuiIndex) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the position of the Node at a given index
+	///
+	/// \param kuiIndex Index of the Node, must be within the grid
+	///
+	/// \return Node position
+	///
+	/////////////////////////////////////////////////
+	const sf::Vector2f& getPosition(const unsigned int kuiIndex) const { return m_positions[kuiIndex]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the random key of the Node at a given index
+	///
+	/// Keys of a set of Nodes are XORed together so the set can be
+	/// compared by one number, updated as Nodes are added.
+	///
+	/// \param kuiIndex Index of the Node, must be within the grid
+	///
+	/// \return Node key
+	///
+	/////////////////////////////////////////////////
+	unsigned long long getKey(const unsigned int kuiIndex) const { return m_keys[kuiIndex]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines the Nodes a Colonist can't stand on because of a circular obstacle
+	///
+	/// Only the Nodes in the box around the obstacle's reach are tested, so
+	/// the cost scales with the obstacle rather than the grid.
+	///
+	/// \param kPosition Centre of the obstacle
+	/// \param kfRadius Radius of the obstacle
+	/// \param kfColonistRadius Radius of the Colonist, Nodes within 1.25 of it from the obstacle are included
+	///
+	/// \return Indices of the Nodes in ascending order
+	///
+	/////////////////////////////////////////////////
+	std::vector<unsigned int> footprint(const sf::Vector2f kPosition, const float kfRadius, const float kfColonistRadius) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of Nodes
+	///
+	/// \return Node count
+	///
+	/////////////////////////////////////////////////
+	unsigned int getNodeCount() const { return (unsigned int)m_positions.size(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the diameter of the Nodes
+	///
+	/// \return Node diameter
+	///
+	/////////////////////////////////////////////////
+	float getNodeDiameter() const { return m_fNodeDiameter; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the id of the grid
+	///
+	/// Caches kept past a grid's lifetime are keyed by id rather than by
+	/// address, which a later grid may reuse.
+	///
+	/// \return Grid id
+	///
+	/////////////////////////////////////////////////
+	unsigned long long getId() const { return m_ullId; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of columns of Nodes
+	///
+	/// \return Column count
+	///
+	/////////////////////////////////////////////////
+	unsigned int getCols() const { return m_uiNodeCols; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of rows of Nodes
+	///
+	/// \return Row count
+	///
+	/////////////////////////////////////////////////
+	unsigned int getRows() const { return m_uiNodeRows; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the memory held by the Node positions and keys
+	///
+	/// \return Size in bytes
+	///
+	/////////////////////////////////////////////////
+	size_t getMemoryUsage() const { return (m_positions.capacity() * sizeof(sf::Vector2f)) + (m_keys.capacity() * sizeof(unsigned long long)); }
+};
+
+#endif
\ No newline at end of file
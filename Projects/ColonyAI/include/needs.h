@@ -0,0 +1,61 @@
+#pragma once
+#ifndef NEEDS_H
+#define NEEDS_H
+
+//!< Struct that holds Colonist needs data
+struct Needs
+{
+public:
+	//!< Default Constructor
+	Needs() {}
+
+	//!< Constructor
+	Needs(const float kfFatalHunger, const float kfFatalThirst)
+	{
+		// Sets member values to corresponding input
+		m_fFatalHunger = kfFatalHunger;
+		m_fFatalThirst = kfFatalThirst;
+		// Defines initial hunger and thirst as 25% of fatal levels
+		setHunger(kfFatalHunger*0.25f);
+		setThirst(kfFatalThirst*0.25f);
+	}
+
+	//!< Sets Hunger level to a new value
+	void setHunger(const float kfHunger)
+	{
+		// Sets value
+		m_fHunger = kfHunger;
+
+		// Caps value between minimum and max Hunger
+		if (m_fHunger < 0.0f) m_fHunger = 0.0f;
+		else if (m_fHunger > m_fFatalHunger) m_fHunger = m_fFatalHunger;
+	}
+	//!< Gets Hunger level
+	float getHunger() { return m_fHunger; }
+	//!< Gets HungerPerc level
+	float getHungerPerc() const { return (m_fHunger / m_fFatalHunger) * 100.0f; }
+
+	//!< Sets Thirst level to a new value
+	void setThirst(const float kfThirst)
+	{
+		// Sets value
+		m_fThirst = kfThirst;
+
+		// Caps value between minimum and max Thirst
+		if (m_fThirst < 0.0f) m_fThirst = 0.0f;
+		else if (m_fThirst > m_fFatalThirst) m_fThirst = m_fFatalThirst;
+	}
+	//!< Gets Thirst level
+	float getThirst() { return m_fThirst; }
+	//!< Gets ThirstPerc level
+	float getThirstPerc() const { return (m_fThirst / m_fFatalThirst) * 100.0f; }
+
+private:
+	float m_fHunger; //!< Hunger need level of the Colonist
+	float m_fThirst; //!< Thirst need level of the Colonist
+
+	float m_fFatalHunger; //!< Hunger need level that kills the Colonist
+	float m_fFatalThirst; //!< Thirst need level that kills the Colonist
+};
+
+#endif
\ No newline at end of file
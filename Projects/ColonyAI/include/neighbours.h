@@ -0,0 +1,51 @@
+#pragma once
+#ifndef NEIGHBOURS_H
+#define NEIGHBOURS_H
+
+const unsigned char g_kucOffGrid = 1; //!< Padded cell flag for cells on the border around the grid
+const unsigned char g_kucBlocked = 2; //!< Padded cell flag for Nodes known to be inaccessible
+
+//!< Struct that holds the column and row step to a neighbouring Node
+struct NeighbourOffset
+{
+	int m_iDX; //!< Column step
+	int m_iDY; //!< Row step
+};
+
+//!< Steps to the 8 neighbours of a Node, clockwise from the upper left, the order searches expand them in
+constexpr NeighbourOffset g_kaNeighbourOffsets[8] = { { -1, -1 }, { 0, -1 }, { 1, -1 }, { 1, 0 }, { 1, 1 }, { 0, 1 }, { -1, 1 }, { -1, 0 } };
+
+/////////////////////////////////////////////////
+///
+/// \brief Struct for the neighbours of a Node, held in place so finding them never allocates
+///
+/// Iterated with a range-based for loop.
+///
+/////////////////////////////////////////////////
+struct AdjacentNodes
+{
+public:
+
+	unsigned int m_auiNodes[8]; //!< Indices of the neighbours found
+	unsigned int m_uiCount = 0; //!< Number of neighbours found
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the first neighbour
+	///
+	/// \return Pointer to the first index
+	///
+	/////////////////////////////////////////////////
+	const unsigned int* begin() const { return m_auiNodes; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns one past the last neighbour
+	///
+	/// \return Pointer past the last index
+	///
+	/////////////////////////////////////////////////
+	const unsigned int* end() const { return m_auiNodes + m_uiCount; }
+};
+
+#endif
\ No newline at end of file
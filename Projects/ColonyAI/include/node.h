@@ -6,27 +6,24 @@
 #include <memory>
 #include "utils.h"
 
+const unsigned int g_kuiNoNode = 0xFFFFFFFF; //!< Index used for no Node
+
 /////////////////////////////////////////////////
 ///
-/// \brief Class used in Pathfinding for calculation
+/// \brief Class for a handle to a cell of the NavGrid
+///
+/// Nodes are small values copied out of the NavGrid's storage, they
+/// don't own any state so they can be passed around freely.
 /// 
 /////////////////////////////////////////////////
 class Node
 {
 private:
 
-	bool m_bAccessible = true; //!< Whether the Node is accessible for pathing
-
-	unsigned int m_uiIndex; //!< Index position within a vector of Nodes
+	unsigned int m_uiIndex = g_kuiNoNode; //!< Index position within the NavGrid
 
 	sf::Vector2f m_position; //!< In-world coordinates
 
-	std::shared_ptr<Node> m_pParent; //!< Previous Node in the path
-
-	float m_fG = 0.f; //!< Total Movement Cost from start Node to this Node
-	float m_fH = 0.f; //!< Distance to target Node
-	float m_fF = 0.f; //!< Combined Heuristic
-
 protected:
 
 public:
@@ -53,44 +50,6 @@ public:
 		m_uiIndex = kuiIndex;
 	}
 
-	/////////////////////////////////////////////////
-	///
-	/// \brief Resets the Node ready for a new path
-	///
-	/// \return void
-	///
-	///////////////////////////////////////////////// 
-	void reset() 
-	{ 
-		// Clears the existing parent Node
-		m_pParent = nullptr;
-
-		// Clears existing G/H/F values
-		m_fG = 0.f;
-		m_fH = 0.f;
-		m_fF = 0.f;
-	}
-
-	/////////////////////////////////////////////////
-	///
-	/// \brief Assigns a new value to the accessible member
-	///
-	/// \param kbValue New accessbility value
-	///
-	/// \return void
-	///
-	///////////////////////////////////////////////// 
-	void setAccessible(const bool kbValue) { m_bAccessible = kbValue; }
-
-	/////////////////////////////////////////////////
-	///
-	/// \brief Returns the accessibility of the Node
-	///
-	/// \return Whether the Node is accessible
-	///
-	///////////////////////////////////////////////// 
-	bool isAccessible() { return m_bAccessible; }
-
 	/////////////////////////////////////////////////
 	///
 	/// \brief Returns the index of the Node
@@ -98,7 +57,7 @@ public:
 	/// \return The Node index value
 	///
 	///////////////////////////////////////////////// 
-	unsigned int getIndex() { return m_uiIndex; }
+	unsigned int getIndex() const { return m_uiIndex; }
 
 	/////////////////////////////////////////////////
 	///
@@ -107,87 +66,16 @@ public:
 	/// \return The Node position
 	///
 	///////////////////////////////////////////////// 
-	sf::Vector2f getPosition() { return m_position; }
-
-	/////////////////////////////////////////////////
-	///
-	/// \brief Assigns a new Node to the parent member
-	///
-	/// \param kpParent New parent Node
-	///
-	/// \return void
-	///
-	///////////////////////////////////////////////// 
-	void setParent(std::shared_ptr<Node> pParent) { m_pParent.swap(pParent); }
-
-	/////////////////////////////////////////////////
-	///
-	/// \brief Returns the parent Node
-	///
-	/// \return The Node's parent Node
-	///
-	///////////////////////////////////////////////// 
-	std::shared_ptr<Node> getParent() { return m_pParent; }
-
-	/////////////////////////////////////////////////
-	///
-	/// \brief Assigns a new value to the G member
-	///
-	/// \param kfG New G value
-	///
-	/// \return void
-	///
-	///////////////////////////////////////////////// 
-	void setG(const float kfG) { m_fG = kfG; }
-
-	/////////////////////////////////////////////////
-	///
-	/// \brief Returns the G value of the Node
-	///
-	/// \return The Node G value
-	///
-	///////////////////////////////////////////////// 
-	float getG() { return m_fG; }
-
-	/////////////////////////////////////////////////
-	///
-	/// \brief Assigns a new value to the H member
-	///
-	/// \param kfH New H value
-	///
-	/// \return void
-	///
-	///////////////////////////////////////////////// 
-	void setH(const float kfH) { m_fH = kfH; }
-
-	/////////////////////////////////////////////////
-	///
-	/// \brief Returns the H value of the Node
-	///
-	/// \return The Node H value
-	///
-	///////////////////////////////////////////////// 
-	float getH() { return m_fH; }
-
-	/////////////////////////////////////////////////
-	///
-	/// \brief Assigns a new value to the F member
-	///
-	/// \param kfF New F value
-	///
-	/// \return void
-	///
-	///////////////////////////////////////////////// 
-	void setF(const float kfF) { m_fF = kfF; }
+	sf::Vector2f getPosition() const { return m_position; }
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Returns the F value of the Node
+	/// \brief Returns whether the Node refers to a cell of the NavGrid
 	///
-	/// \return The Node F value
+	/// \return Whether the Node is valid
 	///
 	///////////////////////////////////////////////// 
-	float getF() { return m_fF; }
+	bool isValid() const { return m_uiIndex != g_kuiNoNode; }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,353 @@
+#pragma once
+#ifndef NODEHEAP_H
+#define NODEHEAP_H
+
+// Imports
+#include <vector>
+
+/////////////////////////////////////////////////
+///
+/// \brief Indexed binary heap used as the Pathfinding open list
+///
+/// Entries are ordered by smallest F value with ties broken by
+/// smallest H value. Each Node index maps to its slot in the heap
+/// so membership checks and decrease-key are O(1) and O(log n).
+///
+/////////////////////////////////////////////////
+class NodeHeap
+{
+private:
+
+	//!< Struct that holds an entry on the heap
+	struct HeapEntry
+	{
+		float m_fF; //!< Combined Heuristic of the Node
+		float m_fH; //!< Distance to target of the Node
+		unsigned int m_uiIndex; //!< Index of the Node within the Pathfinding grid
+	};
+
+	std::vector<HeapEntry> m_entries; //!< Heap ordered entries
+
+	std::vector<int> m_slots; //!< Heap slot of each Node index, -1 when not on the heap
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Determines whether one entry should be popped before another
+	///
+	/// \param kA Entry to compare
+	/// \param kB Entry to compare against
+	///
+	/// \return Whether entry A has priority over entry B
+	///
+	/////////////////////////////////////////////////
+	bool hasPriority(const HeapEntry& kA, const HeapEntry& kB) const
+	{
+		// Smallest F first
+		if (kA.m_fF < kB.m_fF) return true;
+		if (kA.m_fF > kB.m_fF) return false;
+
+		// Equal F: smallest H first
+		return kA.m_fH < kB.m_fH;
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Places an entry into a slot and records the slot
+	///
+	/// \param kuiSlot Slot to place the entry in
+	/// \param kEntry Entry to place
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void place(const unsigned int kuiSlot, const HeapEntry& kEntry)
+	{
+		m_entries[kuiSlot] = kEntry;
+		m_slots[kEntry.m_uiIndex] = (int)kuiSlot;
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Moves the entry in a slot toward the root until ordered
+	///
+	/// \param uiSlot Slot of the entry to move
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void siftUp(unsigned int uiSlot)
+	{
+		// Entry being moved
+		HeapEntry entry = m_entries[uiSlot];
+
+		// While not at the root
+		while (uiSlot > 0)
+		{
+			// Slot of the parent entry
+			unsigned int uiParent = (uiSlot - 1) / 2;
+
+			// If the parent should still be popped first: ordered
+			if (!hasPriority(entry, m_entries[uiParent])) break;
+
+			// Moves the parent down and continues from its slot
+			place(uiSlot, m_entries[uiParent]);
+			uiSlot = uiParent;
+		}
+
+		// Places the entry in its final slot
+		place(uiSlot, entry);
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Moves the entry in a slot toward the leaves until ordered
+	///
+	/// \param uiSlot Slot of the entry to move
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void siftDown(unsigned int uiSlot)
+	{
+		// Entry being moved
+		HeapEntry entry = m_entries[uiSlot];
+		unsigned int uiSize = (unsigned int)m_entries.size();
+
+		// While the slot has a child
+		while ((uiSlot * 2) + 1 < uiSize)
+		{
+			// Picks the child with priority
+			unsigned int uiChild = (uiSlot * 2) + 1;
+			if ((uiChild + 1 < uiSize) && hasPriority(m_entries[uiChild + 1], m_entries[uiChild])) uiChild++;
+
+			// If the entry should be popped before the child: ordered
+			if (!hasPriority(m_entries[uiChild], entry)) break;
+
+			// Moves the child up and continues from its slot
+			place(uiSlot, m_entries[uiChild]);
+			uiSlot = uiChild;
+		}
+
+		// Places the entry in its final slot
+		place(uiSlot, entry);
+	}
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Default Constructor
+	///
+	/////////////////////////////////////////////////
+	NodeHeap() {}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Sizes the heap for a number of Nodes and empties it
+	///
+	/// \param kuiNodeCount Number of Nodes in the grid
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void resize(const unsigned int kuiNodeCount)
+	{
+		m_entries.clear();
+		m_slots.assign(kuiNodeCount, -1);
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Removes every entry, only touching the entries on the heap
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void clear()
+	{
+		// Unmarks every Node that is on the heap
+		for (const HeapEntry& kEntry : m_entries) m_slots[kEntry.m_uiIndex] = -1;
+
+		m_entries.clear();
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether the heap is empty
+	///
+	/// \return Whether there are no entries
+	///
+	/////////////////////////////////////////////////
+	bool empty() const { return m_entries.empty(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the number of entries on the heap
+	///
+	/// \return Entry count
+	///
+	/////////////////////////////////////////////////
+	unsigned int size() const { return (unsigned int)m_entries.size(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the memory held by the heap
+	///
+	/// \return Size in bytes
+	///
+	/////////////////////////////////////////////////
+	size_t getMemoryUsage() const { return (m_entries.capacity() * sizeof(HeapEntry)) + (m_slots.capacity() * sizeof(int)); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether a Node is on the heap
+	///
+	/// \param kuiIndex Index of the Node
+	///
+	/// \return Whether the Node is on the heap
+	///
+	/////////////////////////////////////////////////
+	bool contains(const unsigned int kuiIndex) const { return m_slots[kuiIndex] >= 0; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a Node to the heap
+	///
+	/// \param kuiIndex Index of the Node
+	/// \param kfF F value of the Node
+	/// \param kfH H value of the Node
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void push(const unsigned int kuiIndex, const float kfF, const float kfH)
+	{
+		// Adds the entry as a leaf and moves it up into order
+		HeapEntry entry = { kfF, kfH, kuiIndex };
+		m_entries.push_back(entry);
+		siftUp((unsigned int)m_entries.size() - 1);
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Lowers the F and H of a Node already on the heap
+	///
+	/// \param kuiIndex Index of the Node
+	/// \param kfF New lower F value of the Node
+	/// \param kfH New H value of the Node
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void decreaseKey(const unsigned int kuiIndex, const float kfF, const float kfH)
+	{
+		// Updates the entry in place and moves it up into order
+		unsigned int uiSlot = (unsigned int)m_slots[kuiIndex];
+		m_entries[uiSlot].m_fF = kfF;
+		m_entries[uiSlot].m_fH = kfH;
+		siftUp(uiSlot);
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Changes the F and H of a Node already on the heap, either up or down
+	///
+	/// \param kuiIndex Index of the Node
+	/// \param kfF New F value of the Node
+	/// \param kfH New H value of the Node
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void update(const unsigned int kuiIndex, const float kfF, const float kfH)
+	{
+		// Updates the entry in place and moves it into order whichever way it needs
+		unsigned int uiSlot = (unsigned int)m_slots[kuiIndex];
+		m_entries[uiSlot].m_fF = kfF;
+		m_entries[uiSlot].m_fH = kfH;
+		siftUp(uiSlot);
+		siftDown((unsigned int)m_slots[kuiIndex]);
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Removes a Node from anywhere on the heap
+	///
+	/// \param kuiIndex Index of the Node, must be on the heap
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void remove(const unsigned int kuiIndex)
+	{
+		// Slot of the Node being removed
+		unsigned int uiSlot = (unsigned int)m_slots[kuiIndex];
+		m_slots[kuiIndex] = -1;
+
+		// Moves the last leaf into the slot and moves it into order
+		HeapEntry last = m_entries.back();
+		m_entries.pop_back();
+		if (uiSlot < m_entries.size())
+		{
+			place(uiSlot, last);
+			siftUp(uiSlot);
+			siftDown((unsigned int)m_slots[last.m_uiIndex]);
+		}
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the Node with the smallest F (then H) without removing it
+	///
+	/// \return Index of the Node at the root
+	///
+	/////////////////////////////////////////////////
+	unsigned int top() const { return m_entries.front().m_uiIndex; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the F value of the Node at the root
+	///
+	/// \return F value at the root
+	///
+	/////////////////////////////////////////////////
+	float topF() const { return m_entries.front().m_fF; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the H value of the Node at the root
+	///
+	/// \return H value at the root
+	///
+	/////////////////////////////////////////////////
+	float topH() const { return m_entries.front().m_fH; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Removes the Node with the smallest F (then H) from the heap
+	///
+	/// \return Index of the removed Node
+	///
+	/////////////////////////////////////////////////
+	unsigned int pop()
+	{
+		// Index at the root
+		unsigned int uiIndex = m_entries.front().m_uiIndex;
+		m_slots[uiIndex] = -1;
+
+		// Moves the last leaf to the root and moves it down into order
+		HeapEntry last = m_entries.back();
+		m_entries.pop_back();
+		if (!m_entries.empty())
+		{
+			m_entries.front() = last;
+			siftDown(0);
+		}
+
+		return uiIndex;
+	}
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+#ifndef OBJECTHANDLE_H
+#define OBJECTHANDLE_H
+
+// Imports
+#include "object.h"
+
+//!< Struct that refers to an Object by the typed store it's held in, so it can be reached without a cast
+struct ObjectHandle
+{
+	ObjectType m_type; //!< Type of the Object, which picks the store
+	unsigned int m_uiIndex; //!< Index of the Object in its store
+};
+
+#endif
\ No newline at end of file
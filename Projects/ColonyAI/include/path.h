@@ -0,0 +1,145 @@
+#pragma once
+#ifndef PATH_H
+#define PATH_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <vector>
+#include <queue>
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for a route being followed
+///
+/// Waypoints are held in one contiguous buffer with a cursor at the next
+/// waypoint to reach, so reaching one never moves the rest. The buffer
+/// is kept when a new route is set, so repathing rarely allocates.
+///
+/////////////////////////////////////////////////
+class Path
+{
+private:
+
+	std::vector<sf::Vector2f> m_waypoints; //!< Positions forming the route, including those already reached
+	unsigned int m_uiCursor = 0; //!< Index of the next waypoint to reach
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Default Constructor
+	///
+	/////////////////////////////////////////////////
+	Path() {}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Replaces the route with a queue of waypoints, reusing the buffer
+	///
+	/// \param path Queue of positions, moved in and drained
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void assign(std::queue<sf::Vector2f> path)
+	{
+		// Empties the buffer, keeping its capacity
+		clear();
+
+		// Moves every waypoint into the buffer in order
+		while (!path.empty())
+		{
+			m_waypoints.push_back(path.front());
+			path.pop();
+		}
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Removes every waypoint, keeping the buffer for the next route
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void clear()
+	{
+		m_waypoints.clear();
+		m_uiCursor = 0;
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Moves the cursor past the next waypoint
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void pop() { m_uiCursor++; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether every waypoint has been reached
+	///
+	/// \return Whether no waypoints are left
+	///
+	/////////////////////////////////////////////////
+	bool empty() const { return m_uiCursor >= m_waypoints.size(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the number of waypoints left
+	///
+	/// \return Waypoint count from the cursor on
+	///
+	/////////////////////////////////////////////////
+	unsigned int size() const { return empty() ? 0 : (unsigned int)m_waypoints.size() - m_uiCursor; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the next waypoint to reach, the path must not be empty
+	///
+	/// \return Position of the next waypoint
+	///
+	/////////////////////////////////////////////////
+	const sf::Vector2f& front() const { return m_waypoints[m_uiCursor]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the end of the route, the path must not be empty
+	///
+	/// \return Position of the last waypoint
+	///
+	/////////////////////////////////////////////////
+	const sf::Vector2f& back() const { return m_waypoints.back(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the next waypoint for iterating the waypoints left
+	///
+	/// \return Iterator at the cursor
+	///
+	/////////////////////////////////////////////////
+	std::vector<sf::Vector2f>::const_iterator begin() const { return empty() ? m_waypoints.end() : m_waypoints.begin() + m_uiCursor; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns one past the last waypoint
+	///
+	/// \return Iterator past the end of the route
+	///
+	/////////////////////////////////////////////////
+	std::vector<sf::Vector2f>::const_iterator end() const { return m_waypoints.end(); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the memory held by the waypoint buffer
+	///
+	/// \return Size in bytes
+	///
+	/////////////////////////////////////////////////
+	size_t getMemoryUsage() const { return m_waypoints.capacity() * sizeof(sf::Vector2f); }
+};
+
+#endif
\ No newline at end of file
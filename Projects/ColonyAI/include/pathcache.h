@@ -0,0 +1,160 @@
+#pragma once
+#ifndef PATHCACHE_H
+#define PATHCACHE_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <list>
+#include <map>
+#include <queue>
+#include <mutex>
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for caching paths shared by every Pathfinding in an Environment
+///
+/// Paths are stored by start and target Node, search algorithm and the
+/// knowledge key of the Pathfinding that created them. The knowledge key
+/// changes whenever calcAccess finds new inaccessible Nodes, so a stored
+/// path is only reused by a Pathfinding that knows the same Nodes. When
+/// full, the least recently used path is dropped.
+///
+/////////////////////////////////////////////////
+class PathCache
+{
+private:
+
+	//!< Struct that holds the key a path is found by
+	struct PathKey
+	{
+		unsigned int m_uiStart; //!< Index of the start Node
+		unsigned int m_uiTarget; //!< Index of the target Node
+		int m_iMode; //!< Search algorithm used
+		bool m_bIgnoreAccess; //!< Whether Node (in)accessibility was ignored
+		unsigned long long m_ullKnowledge; //!< Knowledge key, 0 when ignoring accessibility
+
+		bool operator<(const PathKey& kOther) const
+		{
+			if (m_uiStart != kOther.m_uiStart) return m_uiStart < kOther.m_uiStart;
+			if (m_uiTarget != kOther.m_uiTarget) return m_uiTarget < kOther.m_uiTarget;
+			if (m_iMode != kOther.m_iMode) return m_iMode < kOther.m_iMode;
+			if (m_bIgnoreAccess != kOther.m_bIgnoreAccess) return m_bIgnoreAccess < kOther.m_bIgnoreAccess;
+			return m_ullKnowledge < kOther.m_ullKnowledge;
+		}
+	};
+
+	//!< Struct that holds a cached path
+	struct PathEntry
+	{
+		PathKey m_key; //!< Key the path is found by
+		std::queue<sf::Vector2f> m_path; //!< Queue of positions forming the route, empty if there is none
+	};
+
+	std::list<PathEntry> m_entries; //!< Cached paths, most recently used first
+	std::map<PathKey, std::list<PathEntry>::iterator> m_index; //!< Position of each cached path in m_entries
+
+	unsigned int m_uiCapacity; //!< Most paths held at once
+
+	unsigned int m_uiHits = 0; //!< Count of lookups that found a path
+	unsigned int m_uiMisses = 0; //!< Count of lookups that didn't
+
+	std::mutex m_mutex; //!< Guards the cache, which the path request workers share
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Creates the key for a path
+	///
+	/// \param kuiStart Index of the start Node
+	/// \param kuiTarget Index of the target Node
+	/// \param kiMode Search algorithm used
+	/// \param kbIgnoreAccess Whether Node (in)accessibility was ignored
+	/// \param kullKnowledge Knowledge key of the Pathfinding
+	///
+	/// \return The key
+	///
+	/////////////////////////////////////////////////
+	static PathKey makeKey(const unsigned int kuiStart, const unsigned int kuiTarget, const int kiMode, const bool kbIgnoreAccess, const unsigned long long kullKnowledge);
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param kuiCapacity Most paths to hold at once
+	///
+	/////////////////////////////////////////////////
+	PathCache(const unsigned int kuiCapacity);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Finds a path, marking it as the most recently used
+	///
+	/// \param kuiStart Index of the start Node
+	/// \param kuiTarget Index of the target Node
+	/// \param kiMode Search algorithm used
+	/// \param kbIgnoreAccess Whether Node (in)accessibility is ignored
+	/// \param kullKnowledge Knowledge key of the Pathfinding
+	/// \param path Queue to set to the path when one is found
+	///
+	/// \return Whether the path was cached
+	///
+	/////////////////////////////////////////////////
+	bool find(const unsigned int kuiStart, const unsigned int kuiTarget, const int kiMode, const bool kbIgnoreAccess, const unsigned long long kullKnowledge, std::queue<sf::Vector2f>& path);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a path, dropping the least recently used if full
+	///
+	/// \param kuiStart Index of the start Node
+	/// \param kuiTarget Index of the target Node
+	/// \param kiMode Search algorithm used
+	/// \param kbIgnoreAccess Whether Node (in)accessibility was ignored
+	/// \param kullKnowledge Knowledge key of the Pathfinding
+	/// \param kPath The path, empty if there is none
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void insert(const unsigned int kuiStart, const unsigned int kuiTarget, const int kiMode, const bool kbIgnoreAccess, const unsigned long long kullKnowledge, const std::queue<sf::Vector2f>& kPath);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Drops every path and resets the counters
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void clear();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of lookups that found a path
+	///
+	/// \return Hit count
+	///
+	/////////////////////////////////////////////////
+	unsigned int getHits() { std::lock_guard<std::mutex> lock(m_mutex); return m_uiHits; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of lookups that didn't find a path
+	///
+	/// \return Miss count
+	///
+	/////////////////////////////////////////////////
+	unsigned int getMisses() { std::lock_guard<std::mutex> lock(m_mutex); return m_uiMisses; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of paths held
+	///
+	/// \return Path count
+	///
+	/////////////////////////////////////////////////
+	unsigned int getSize() { std::lock_guard<std::mutex> lock(m_mutex); return (unsigned int)m_entries.size(); }
+};
+
+#endif
\ No newline at end of file
@@ -8,11 +8,29 @@
 #include <iostream>
 #include <stdlib.h>
 #include <queue>
+#include <algorithm>
 #include <memory>
+#include "astarsearch.h"
+#include "bidirectionalsearch.h"
+#include "cellgrid.h"
+#include "clustergraph.h"
+#include "dstarlite.h"
 #include "environment.h"
+#include "flowfield.h"
+#include "gridsearch.h"
+#include "hierarchicalsearch.h"
+#include "jumppointsearch.h"
+#include "landmarks.h"
+#include "navgrid.h"
 #include "node.h"
+#include "path.h"
+#include "pathcache.h"
+#include "pathservice.h"
+#include "searchbuffer.h"
 #include "utils.h"
 
+enum SearchMode { ASTAR, JPS, HPA, BIDIRECTIONAL }; //!< Enum for Pathfinding search algorithms
+
 /////////////////////////////////////////////////
 ///
 /// \brief Class for pathfinding
@@ -22,78 +40,297 @@ class Pathfinding
 {
 private:
 
-	std::queue<sf::Vector2f> m_path; //!< Queue of positions forming a route
+	std::shared_ptr<std::vector<Path>> m_pPaths = std::shared_ptr<std::vector<Path>>(new std::vector<Path>(1)); //!< Store the route being followed is kept in, its own unless a Colonist's component store is shared
+	unsigned int m_uiPathSlot = 0; //!< Slot of the route being followed in the store
 
 	std::shared_ptr<Environment> m_pEnv; //!< Pointer to the Environment the Pathfinding is operating in
 
-	std::vector<std::shared_ptr<Node>> m_pNodes; //!< Vector of Nodes
+	std::shared_ptr<NavGrid> m_pGrid; //!< Grid of Nodes shared by the Environment
+
+	CellGrid m_cells; //!< Inaccessible bit of each Node in a grid with a one cell border, the only record of what this Pathfinding knows to be inaccessible
+	unsigned long long m_ullKnowledge = 0; //!< Keys of the inaccessible Nodes XORed together, identifies what this Pathfinding knows
+
+	std::shared_ptr<ClusterGraph> m_pClusters; //!< Abstract graph over the grid used by HPA searches
+
+	const unsigned int m_kuiClusterSize = 10; //!< Width and height of an HPA cluster in Nodes
+
+	std::shared_ptr<FlowFieldCache> m_pFieldCache; //!< Flow fields shared by the Environment
+	std::vector<std::shared_ptr<FlowField>> m_pFlowFields; //!< Flow fields held for targets this Pathfinding has routed to, least recently used first
+	const unsigned int m_kuiFlowFieldLimit = 8; //!< Most flow fields held at once
+
+	std::shared_ptr<PathCache> m_pPathCache; //!< Recently created paths shared by the Environment
+
+	std::shared_ptr<DStarLite> m_pReplanner; //!< Incremental search used to repair the path when Nodes become inaccessible, lent by the Environment until the path is replaced
+	std::vector<unsigned int> m_changedNodes; //!< Nodes that became inaccessible since the replanner last planned
+
+	std::shared_future<PathResult> m_pendingPath; //!< Result of the last path request, invalid when none is pending
+
+	std::shared_ptr<SearchBuffer> m_pSliceBuffer; //!< Search state kept between updates by the time-sliced search, lent by the Environment until the search ends
+	bool m_bSlicing = false; //!< Whether a time-sliced search is in progress
+	unsigned int m_uiSliceStart = g_kuiNoNode; //!< Index of the Node the time-sliced search started from
+	unsigned int m_uiSliceCurrent = g_kuiNoNode; //!< Index of the Node the time-sliced search expands next
+	unsigned int m_uiSliceTarget = g_kuiNoNode; //!< Index of the Node the time-sliced search is routing toward
+	bool m_bSliceIgnoreAccess = false; //!< Whether the time-sliced search ignores Node (in)accessibility
+	unsigned long long m_ullSliceKnowledge = 0; //!< Knowledge key when the time-sliced search started
+
+	bool m_bLogging = true; //!< Whether progress is written to sf::err(), off for snapshots and Pathfinding searched off the update thread
 
 	bool m_bNodesInit = false; //!< Whether the Nodes have been initialised
 
-	float m_fNodeDiameter = 20.0f; //!< Diameter of the Nodes
-	float m_fNodeRadius = m_fNodeDiameter/2; //!< Radius of the Nodes
+	unsigned int m_uiExpansions = 0; //!< Count of Nodes expanded by searches
+
+	SearchMode m_searchMode = ASTAR; //!< Algorithm used by createPathTo
+	Heuristic m_heuristic = MANHATTAN; //!< Estimate of the distance left used by A* and JPS
+
+	std::shared_ptr<Landmarks> m_pLandmarks; //!< Landmark distance tables shared by the Environment, nullptr if it has none
+	unsigned int m_uiLandmarkBlockedKnown = 0; //!< Count of Nodes inaccessible to the landmark tables that are known to be inaccessible
+	bool m_bLandmarksCovered = false; //!< Whether every Node the landmark tables were built with is known to be inaccessible, so their bounds are admissible
+
+	bool m_bSmoothing = false; //!< Whether paths have waypoints with line of sight between them removed
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets a search scratch buffer of the calling thread
+	///
+	/// \param kuiNodeCount Number of Nodes the buffer must hold
+	/// \param kuiSlot Which of the thread's two buffers to get, searches from both ends use both
+	///
+	/// \return The thread's SearchBuffer
+	///
+	///////////////////////////////////////////////// 
+	static SearchBuffer& searchBuffer(const unsigned int kuiNodeCount, const unsigned int kuiSlot);
 
-	unsigned int m_uiNodeCols; //!< Count for required columns of Nodes
-	unsigned int m_uiNodeRows; //!< Count for required rows of Nodes
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the stream progress is written to
+	///
+	/// \return sf::err(), or a stream that discards everything when logging is off
+	///
+	///////////////////////////////////////////////// 
+	std::ostream& log();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Copies what's needed to search off the update thread
+	///
+	/// The copy shares only the read-only grid. Accessibility and, when
+	/// asked for, the cluster graph are copied so later changes don't reach it.
+	///
+	/// \param kbWithClusters Whether the search will need the cluster graph
+	///
+	/// \return A Pathfinding that can be searched with on another thread
+	///
+	///////////////////////////////////////////////// 
+	std::shared_ptr<Pathfinding> snapshot(const bool kbWithClusters);
 	
 	/////////////////////////////////////////////////
 	///
-	/// \brief Calculates G value of a Node
+	/// \brief Starts a time-sliced search, expanded by collectPath within the Environment's budget
 	///
-	/// \param kpCurrentNode The current Node to calculate G for
-	/// \param kpTargetNode Node that proceeds the current Node in the path
+	/// \param kCurrentPos Start point to path from
+	/// \param kTargetNode Node to route toward
+	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
 	///
-	/// \return The calculated G value
+	/// \return void
 	///
 	///////////////////////////////////////////////// 
-	float calcG(const std::shared_ptr<Node> kpCurrentNode, const std::shared_ptr<Node> kpTargetNode);
+	void beginSlicedPath(const sf::Vector2f kCurrentPos, const Node kTargetNode, const bool kbIgnoreAccess);
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Detemines whether a Node is within a vector of Nodes
+	/// \brief Returns whether the Node at an index is accessible as far as this Pathfinding knows
 	///
-	/// \param kpNodeToFind Node to locate within vector
-	/// \param kpVector Vector of Nodes to search through
+	/// \param kuiIndex Index of the Node to check
 	///
-	/// \return Whether the Node is in the vector
+	/// \return Whether the Node is accessible
 	///
 	///////////////////////////////////////////////// 
-	bool nodeInVector(const std::shared_ptr<Node> kpNodeToFind, const std::vector<std::shared_ptr<Node>> kpVector);
+	bool isAccessible(const unsigned int kuiIndex);
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Detemines the distance from one Node to another with the manhattan algorithm
+	/// \brief Returns the landmark tables for searches to bound with, if their bounds are admissible
 	///
-	/// \param kpStartNode Node to calculate distance from
-	/// \param kpEndNode Node to calculate distance to
+	/// The bounds are admissible once every Node the tables were built with
+	/// is known to be inaccessible.
 	///
-	/// \return Distance to the end Node
+	/// \return The landmark tables, nullptr if their bounds aren't admissible yet
 	///
 	///////////////////////////////////////////////// 
-	float distance(const std::shared_ptr<Node> kpStartNode, const std::shared_ptr<Node> kpEndNode);
+	const Landmarks* admissibleLandmarks() { return (m_bLandmarksCovered) ? m_pLandmarks.get() : nullptr; }
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Generates a vector of adjacent Nodes that can be pathed to
+	/// \brief Determines whether a straight line between two Nodes crosses only accessible Nodes
+	///
+	/// Every Node the line passes through is checked. Where the line passes
+	/// exactly through a corner, both Nodes beside it must be accessible, the
+	/// same rule diagonal steps follow.
 	///
-	/// \param kpNode Node to calculate surroundings with
-	/// \param kbStrictDiagonal Boolean for whether to allow diagonal adjacency if it crosses another Node
+	/// \param kuiFrom Index of the Node the line starts at
+	/// \param kuiTo Index of the Node the line ends at
 	///
-	/// \return Nodes adjacent to the given Node
+	/// \return Whether there is line of sight between the Nodes
 	///
 	///////////////////////////////////////////////// 
-	std::vector<std::shared_ptr<Node>> adjacentNodes(const std::shared_ptr<Node> kpNode, const bool kbStrictDiagonal);
+	bool lineOfSight(const unsigned int kuiFrom, const unsigned int kuiTo);
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Creates a queue of points from a given destination back to the current position
+	/// \brief Removes waypoints that can be walked past in a straight line, if smoothing is on
+	///
+	/// Pulls the path taut: from each kept waypoint, the furthest following
+	/// waypoint still in line of sight is kept next.
+	///
+	/// \param kPath Queue of points forming the route, starting at the start point
 	///
-	/// \param pNode Node to queue a path back from
+	/// \return The smoothed route
 	///
-	/// \return A queue of positions from destination back to current position
+	///////////////////////////////////////////////// 
+	std::queue<sf::Vector2f> smoothPath(const std::queue<sf::Vector2f>& kPath);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Labels each group of accessible Nodes connected to each other
+	///
+	/// Nodes are connected through their orthogonal neighbours. Diagonal
+	/// steps need both orthogonal neighbours accessible, so they never join
+	/// Nodes that aren't already connected.
+	///
+	/// \param labels Vector to fill with the group of each Node, g_kuiNoNode for inaccessible Nodes
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void labelComponents(std::vector<unsigned int>& labels);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the connected group labels for what this Pathfinding knows
+	///
+	/// Each thread keeps the labels of the few sets of inaccessible Nodes it
+	/// last labelled, found by grid and knowledge key, so Pathfindings that
+	/// know the same share them and none hold a copy of their own.
+	///
+	/// \return Label of the group each Node is in
+	///
+	///////////////////////////////////////////////// 
+	const std::vector<unsigned int>& components();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the replanner to the Environment, forgetting its plan
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void releaseReplanner();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Marks Nodes as inaccessible, updating what depends on them
+	///
+	/// \param kNodes Indices of the Nodes to mark
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void markInaccessible(const std::vector<unsigned int>& kNodes);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Refines the leg of the path from a reached point to the front of the queue
+	///
+	/// \param kReached The point just reached
+	///
+	/// \return void
 	///
 	///////////////////////////////////////////////// 
-	std::queue<sf::Vector2f> queuePath(std::shared_ptr<Node> pNode);
+	void refinePath(const sf::Vector2f kReached);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether the path steps onto or diagonally past an inaccessible Node
+	///
+	/// \return Whether the path is blocked
+	///
+	///////////////////////////////////////////////// 
+	bool pathBlocked();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Repairs the path around newly inaccessible Nodes with the replanner
+	///
+	/// The path is replanned from its front to its back, clearing it if
+	/// its end can no longer be reached.
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void repairPath();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets a flow field to a target over the Nodes every Object's footprint covers
+	///
+	/// Fields are computed against the Environment's footprints rather than
+	/// what this Pathfinding knows, so every Pathfinding routing to a target
+	/// shares one. A held field is used if it's current, otherwise a shared
+	/// one from the Environment, otherwise the held field is repaired or a
+	/// new one is computed and shared. Only the most recently used fields
+	/// are held.
+	///
+	/// \param kTargetPos Position of the target
+	/// \param kfTargetRadius Radius of the target
+	///
+	/// \return The field, nullptr if the target has no accessible perimeter
+	///
+	///////////////////////////////////////////////// 
+	std::shared_ptr<FlowField> flowField(const sf::Vector2f kTargetPos, const float kfTargetRadius);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Generates a perimeter of Nodes around a given position over a set of inaccessible Nodes
+	///
+	/// \param kPosition Position to calculate perimeter around
+	/// \param kfRadius Radius around the position to cap the search
+	/// \param kCells Inaccessible bit of each Node
+	///
+	/// \return Perimeter Nodes
+	///
+	///////////////////////////////////////////////// 
+	std::vector<Node> perimeterNodes(const sf::Vector2f kPosition, const float kfRadius, const CellGrid& kCells);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Creates a path to the nearest perimeter Node of a target that can be reached
+	///
+	/// \param kCurrentPos Start point to path from
+	/// \param kTargetPos Position of the target
+	/// \param kfTargetRadius Radius of the target
+	///
+	/// \return A queue of points that represent a route, empty if no perimeter Node can be reached
+	///
+	///////////////////////////////////////////////// 
+	std::queue<sf::Vector2f> createPathToNearest(const sf::Vector2f kCurrentPos, const sf::Vector2f kTargetPos, const float kfTargetRadius);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the route being followed from its store
+	///
+	/// \return The path by reference
+	///
+	///////////////////////////////////////////////// 
+	Path& currentPath() { return (*m_pPaths)[m_uiPathSlot]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the route being followed from its store
+	///
+	/// \return The path by const reference
+	///
+	///////////////////////////////////////////////// 
+	const Path& currentPath() const { return (*m_pPaths)[m_uiPathSlot]; }
 
 protected:
 
@@ -108,18 +345,91 @@ public:
 	///////////////////////////////////////////////// 
 	Pathfinding(const std::shared_ptr<Environment> kpEnvironment);
 
+	/////////////////////////////////////////////////
+	///
+	/// \brief Destructor, returns any lent buffers to the Environment
+	///
+	///////////////////////////////////////////////// 
+	~Pathfinding();
+
 	/////////////////////////////////////////////////
 	///
 	/// \brief Creates a path to target Node
 	///
 	/// \param kCurrentPos Start point to path from
-	/// \param kpTargetNode Node to route toward
+	/// \param kTargetNode Node to route toward
 	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
 	///
 	/// \return A queue of points that represent a route
 	///
 	///////////////////////////////////////////////// 
-	std::queue<sf::Vector2f> createPathTo(const sf::Vector2f kCurrentPos, const std::shared_ptr<Node> kpTargetNode, const bool kbIgnoreAccess);
+	std::queue<sf::Vector2f> createPathTo(const sf::Vector2f kCurrentPos, const Node kTargetNode, const bool kbIgnoreAccess);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Creates a path to target Node with a given search algorithm
+	///
+	/// \param kCurrentPos Start point to path from
+	/// \param kTargetNode Node to route toward
+	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
+	/// \param kMode Search algorithm to use for this path only
+	///
+	/// \return A queue of points that represent a route
+	///
+	///////////////////////////////////////////////// 
+	std::queue<sf::Vector2f> createPathTo(const sf::Vector2f kCurrentPos, const Node kTargetNode, const bool kbIgnoreAccess, const SearchMode kMode);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Requests a path to target Node from the Environment's workers
+	///
+	/// The current path is kept until the result is collected. A newer
+	/// request replaces one still pending. Without workers the search is
+	/// time-sliced instead, expanding within the Environment's per-update
+	/// budget each time the path is collected.
+	///
+	/// \param kCurrentPos Start point to path from
+	/// \param kTargetNode Node to route toward
+	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void requestPathTo(const sf::Vector2f kCurrentPos, const Node kTargetNode, const bool kbIgnoreAccess);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Sets the path to the result of the last request if it has arrived
+	///
+	/// A time-sliced request is expanded further first, spending from the
+	/// Environment's expansion budget.
+	///
+	/// \return Whether a result was collected
+	///
+	///////////////////////////////////////////////// 
+	bool collectPath();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether a requested path hasn't been collected yet
+	///
+	/// \return Whether a request is pending
+	///
+	///////////////////////////////////////////////// 
+	bool pathPending() { return m_pendingPath.valid() || m_bSlicing; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Creates a path to the nearest perimeter Node of a target by following its flow field
+	///
+	/// \param kCurrentPos Start point to path from
+	/// \param kTargetPos Position of the target
+	/// \param kfTargetRadius Radius of the target
+	///
+	/// \return A queue of points that represent a route
+	///
+	///////////////////////////////////////////////// 
+	std::queue<sf::Vector2f> createFlowPath(const sf::Vector2f kCurrentPos, const sf::Vector2f kTargetPos, const float kfTargetRadius);
 
 	/////////////////////////////////////////////////
 	///
@@ -134,16 +444,42 @@ public:
 	///////////////////////////////////////////////// 
 	void calcAccess(const float kfColonistRadius, const sf::Vector2f kPosition, const float kfRadius);
 
+	/////////////////////////////////////////////////
+	///
+	/// \brief Calculates which Nodes are accessible with a known Object
+	///
+	/// Uses the Object's footprint shared by the Environment when it was
+	/// built for the same radius, rather than working it out again.
+	///
+	///	\param kfColonistRadius The Colonist's radius for clearance calucating
+	///	\param kpObject The Object that will be inaccessible
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void calcAccess(const float kfColonistRadius, const std::shared_ptr<Object> kpObject);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether a Node is accessible as far as this Pathfinding knows
+	///
+	/// \param kNode Node to check
+	///
+	/// \return Whether the Node is accessible
+	///
+	///////////////////////////////////////////////// 
+	bool isAccessible(const Node kNode);
+
 	/////////////////////////////////////////////////
 	///
 	/// \brief Detemines the Node that a given position falls within
 	///
 	/// \param kPosition Position to calculate a local Node with
 	///
-	/// \return Node at position
+	/// \return Node at position, invalid if there is none
 	///
 	///////////////////////////////////////////////// 
-	std::shared_ptr<Node> nodeFromPos(const sf::Vector2f kPosition);
+	Node nodeFromPos(const sf::Vector2f kPosition);
 
 	/////////////////////////////////////////////////
 	///
@@ -151,10 +487,10 @@ public:
 	///
 	/// \param kuiIndex Index to get the Node with
 	///
-	/// \return Node at index
+	/// \return Node at index, invalid if there is none
 	///
 	///////////////////////////////////////////////// 
-	std::shared_ptr<Node> nodeFromIndex(const unsigned int kuiIndex);
+	Node nodeFromIndex(const unsigned int kuiIndex);
 
 	/////////////////////////////////////////////////
 	///
@@ -166,62 +502,227 @@ public:
 	/// \return Perimeter Nodes
 	///
 	///////////////////////////////////////////////// 
-	std::vector<std::shared_ptr<Node>> perimeterNodes(const sf::Vector2f kPosition, const float kfRadius);
+	std::vector<Node> perimeterNodes(const sf::Vector2f kPosition, const float kfRadius);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Generates a perimeter of Nodes around a given position that can be reached from a point
+	///
+	/// \param kPosition Position to calculate perimeter around
+	/// \param kfRadius Radius around the position to cap the search
+	/// \param kFromPos Point the Nodes must be reachable from
+	///
+	/// \return Perimeter Nodes reachable from the point
+	///
+	///////////////////////////////////////////////// 
+	std::vector<Node> perimeterNodes(const sf::Vector2f kPosition, const float kfRadius, const sf::Vector2f kFromPos);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether a path respecting accessibility can exist between two Nodes
+	///
+	/// Compares connected group labels, relabelling first if more Nodes have
+	/// become known to be inaccessible. A start on an inaccessible Node can
+	/// reach the groups of its accessible orthogonal neighbours.
+	///
+	/// \param kuiFrom Index of the Node to path from
+	/// \param kuiTo Index of the Node to path to
+	///
+	/// \return Whether the Node can be reached
+	///
+	///////////////////////////////////////////////// 
+	bool reachable(const unsigned int kuiFrom, const unsigned int kuiTo);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of Nodes
+	///
+	/// \return Node count
+	///
+	///////////////////////////////////////////////// 
+	unsigned int getNodeCount() { return m_bNodesInit ? m_pGrid->getNodeCount() : 0; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the memory held by this Pathfinding
+	///
+	/// Counts the inaccessible bits, the cluster graph, the path and every
+	/// buffer lent to it. Flow fields held are counted in full, though
+	/// other Pathfindings routing to the same target may share them.
+	///
+	/// \return Size in bytes
+	///
+	///////////////////////////////////////////////// 
+	size_t getMemoryUsage();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Sets the algorithm used by createPathTo
+	///
+	/// \param kMode Search algorithm
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void setSearchMode(const SearchMode kMode) { m_searchMode = kMode; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the algorithm used by createPathTo
+	///
+	/// \return Search algorithm
+	///
+	///////////////////////////////////////////////// 
+	SearchMode getSearchMode() { return m_searchMode; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Sets whether paths are smoothed by removing waypoints with line of sight between them
+	///
+	/// \param kbSmoothing Whether to smooth paths
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void setSmoothing(const bool kbSmoothing) { m_bSmoothing = kbSmoothing; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets whether paths are smoothed
+	///
+	/// \return Whether paths are smoothed
+	///
+	///////////////////////////////////////////////// 
+	bool getSmoothing() { return m_bSmoothing; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Sets the estimate of the distance left used by A* and JPS
+	///
+	/// \param kHeuristic Heuristic to use
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void setHeuristic(const Heuristic kHeuristic) { m_heuristic = kHeuristic; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Sets whether progress is written to sf::err()
+	///
+	/// \param kbLogging Whether to log, off when searching off the update thread
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void setLogging(const bool kbLogging) { m_bLogging = kbLogging; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the estimate of the distance left used by A* and JPS
+	///
+	/// \return Heuristic in use
+	///
+	///////////////////////////////////////////////// 
+	Heuristic getHeuristic() { return m_heuristic; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether searches respecting accessibility take the landmark bounds
+	///
+	/// \return Whether ALT is selected and the landmark tables are admissible for what's known
+	///
+	///////////////////////////////////////////////// 
+	bool usesLandmarks() { return (m_heuristic == ALT) && m_bLandmarksCovered; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of Nodes expanded by searches so far
+	///
+	/// \return Expansion count
+	///
+	///////////////////////////////////////////////// 
+	unsigned int getExpansions() { return m_uiExpansions + ((m_pClusters != nullptr) ? m_pClusters->getExpansions() : 0); }
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Gets the vector of Nodes
+	/// \brief Sets the path, dropping any pending request
 	///
-	/// \return Vector of Nodes
+	/// \param path Queue of positions, moved into the path's buffer
+	///
+	/// \return void
 	///
 	///////////////////////////////////////////////// 
-	std::vector<std::shared_ptr<Node>> getNodes() { return m_pNodes; }
+	void setPath(std::queue<sf::Vector2f> path);
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Sets the path queue
+	/// \brief Moves the path into a slot of a store shared with its owner, and keeps it there
 	///
-	/// \param Queue of positions
+	/// \param pPaths Store of routes, which mustn't grow while this Pathfinding is used off the update thread
+	/// \param kuiSlot Slot of the route in the store
 	///
 	/// \return void
 	///
 	///////////////////////////////////////////////// 
-	void setPath(std::queue<sf::Vector2f> kPath) { m_path = kPath; }
+	void setPathStore(std::shared_ptr<std::vector<Path>> pPaths, const unsigned int kuiSlot);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the path
+	///
+	/// \return The route being followed, read from its next waypoint
+	///
+	///////////////////////////////////////////////// 
+	const Path& getPath() const { return currentPath(); }
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Gets the path queue
+	/// \brief Returns whether the path ends at the perimeter of a target
 	///
-	/// \return Queue of positions
+	/// \param kTargetPos Position of the target
+	/// \param kfTargetRadius Radius of the target
+	///
+	/// \return Whether the path leads to the target
 	///
 	///////////////////////////////////////////////// 
-	std::queue<sf::Vector2f> getPath() { return m_path; }
+	bool pathLeadsTo(const sf::Vector2f kTargetPos, const float kfTargetRadius);
 
 	/////////////////////////////////////////////////
 	///
 	/// \brief Pops the first element off the path queue
 	///
+	/// HPA paths are refined a leg at a time, the next leg is refined
+	/// when the point before it is popped.
+	///
+	/// \return void
+	///
+	///////////////////////////////////////////////// 
+	void popPath();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Refines the leg after a waypoint that's been reached and removed from the path
+	///
+	/// Lets the path be followed outside the Pathfinding, as the
+	/// Environment's movement system does, with HPA legs still refined
+	/// a leg at a time.
+	///
+	/// \param kReached Position of the waypoint reached
+	///
 	/// \return void
 	///
 	///////////////////////////////////////////////// 
-	void popPath() { m_path.pop(); }
+	void reachedWaypoint(const sf::Vector2f kReached);
 
 	/////////////////////////////////////////////////
 	///
-	/// \brief Pops off every element in the path queue
+	/// \brief Removes every waypoint from the path
 	///
 	/// \return void
 	///
 	///////////////////////////////////////////////// 
-	void clearPath() 
-	{
-		// If path is not empty
-		while (!m_path.empty())
-		{
-			// Pops element off the path
-			m_path.pop();
-		}
-	}
+	void clearPath();
 
 	/////////////////////////////////////////////////
 	///
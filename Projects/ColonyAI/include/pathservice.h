@@ -0,0 +1,112 @@
+#pragma once
+#ifndef PATHSERVICE_H
+#define PATHSERVICE_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include "node.h"
+
+class Pathfinding;
+
+//!< Struct that holds the outcome of a path request
+struct PathResult
+{
+	std::queue<sf::Vector2f> m_path; //!< Queue of positions forming the route, empty if there is none
+	unsigned int m_uiExpansions; //!< Count of Nodes expanded solving the request
+};
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for solving path requests on a pool of worker threads
+///
+/// Each request carries a snapshot of the requesting Pathfinding, so the
+/// workers never read state the update thread is changing. Results are
+/// handed back through a future the requester checks on later updates,
+/// never waiting on it, so a long search doesn't hold up an update.
+///
+/////////////////////////////////////////////////
+class PathService
+{
+private:
+
+	//!< Struct that holds a request waiting for a worker
+	struct PathRequest
+	{
+		std::shared_ptr<Pathfinding> m_pSnapshot; //!< Copy of the requesting Pathfinding to search with
+		sf::Vector2f m_start; //!< Start point to path from
+		Node m_target; //!< Node to route toward
+		bool m_bIgnoreAccess; //!< Whether to ignore Node (in)accessibility
+		std::promise<PathResult> m_result; //!< Promise fulfilled with the path
+	};
+
+	std::vector<std::thread> m_workers; //!< Threads that solve requests
+
+	std::deque<std::shared_ptr<PathRequest>> m_pRequests; //!< Requests waiting for a worker
+
+	std::mutex m_mutex; //!< Guards the requests and counters
+	std::condition_variable m_requestAdded; //!< Signalled when a request is added or the service stops
+
+	bool m_bStopping = false; //!< Whether the workers should exit
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Solves requests until the service stops, run by each worker
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void work();
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param kuiWorkers Number of worker threads to start
+	///
+	/////////////////////////////////////////////////
+	PathService(const unsigned int kuiWorkers);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Destructor, solves the queued requests then stops and joins the workers
+	///
+	/////////////////////////////////////////////////
+	~PathService();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Queues a request for a path to target Node
+	///
+	/// \param pSnapshot Copy of the requesting Pathfinding, owned by the request from now on
+	/// \param kStart Start point to path from
+	/// \param kTarget Node to route toward
+	/// \param kbIgnoreAccess Whether to ignore Node (in)accessibility
+	///
+	/// \return Future holding the result once a worker has solved it
+	///
+	/////////////////////////////////////////////////
+	std::shared_future<PathResult> submit(std::shared_ptr<Pathfinding> pSnapshot, const sf::Vector2f kStart, const Node kTarget, const bool kbIgnoreAccess);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of worker threads
+	///
+	/// \return Worker count
+	///
+	/////////////////////////////////////////////////
+	unsigned int getWorkerCount() const { return (unsigned int)m_workers.size(); }
+};
+
+#endif
\ No newline at end of file
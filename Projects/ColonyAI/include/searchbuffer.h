@@ -0,0 +1,158 @@
+#pragma once
+#ifndef SEARCHBUFFER_H
+#define SEARCHBUFFER_H
+
+// Imports
+#include <vector>
+#include "nodeheap.h"
+#include "node.h"
+
+/////////////////////////////////////////////////
+///
+/// \brief Struct that holds the scratch state of a search
+///
+/// One buffer exists per thread and is reused by every Pathfinding
+/// searching on that thread, so searches don't write to the shared NavGrid.
+///
+/// Each search takes a new generation number. A Node's G/H/F and parent
+/// only belong to the current search if its visited stamp matches the
+/// generation, so nothing has to be cleared between searches.
+///
+/////////////////////////////////////////////////
+struct SearchBuffer
+{
+public:
+
+	std::vector<float> m_fG; //!< Total Movement Cost from start Node to each Node
+	std::vector<float> m_fH; //!< Distance from each Node to the target Node
+	std::vector<float> m_fF; //!< Combined Heuristic of each Node
+	std::vector<unsigned int> m_uiParents; //!< Index of the previous Node in the path of each Node, g_kuiNoNode for none
+
+	std::vector<unsigned int> m_uiVisited; //!< Generation in which each Node's search values were last set
+	std::vector<unsigned int> m_uiClosed; //!< Generation in which each Node was last closed
+
+	unsigned int m_uiGeneration = 0; //!< Generation of the current search
+
+	NodeHeap m_openNodes; //!< Open list of Node indices ordered by F then H
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Sizes the buffer for a number of Nodes
+	///
+	/// \param kuiNodeCount Number of Nodes in the grid being searched
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void prepare(const unsigned int kuiNodeCount)
+	{
+		// If the buffer is already sized for the grid: nothing to do
+		if (m_fG.size() == kuiNodeCount) return;
+
+		m_fG.assign(kuiNodeCount, 0.f);
+		m_fH.assign(kuiNodeCount, 0.f);
+		m_fF.assign(kuiNodeCount, 0.f);
+		m_uiParents.assign(kuiNodeCount, g_kuiNoNode);
+		m_uiVisited.assign(kuiNodeCount, 0);
+		m_uiClosed.assign(kuiNodeCount, 0);
+		m_uiGeneration = 0;
+		m_openNodes.resize(kuiNodeCount);
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Starts a new search, invalidating the values of the last one
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void beginSearch()
+	{
+		// Empties the open list of the previous search
+		m_openNodes.clear();
+
+		// Moves to the next generation
+		m_uiGeneration++;
+
+		// If the generation wrapped around: clears the stamps so old ones can't match
+		if (m_uiGeneration == 0)
+		{
+			m_uiVisited.assign(m_uiVisited.size(), 0);
+			m_uiClosed.assign(m_uiClosed.size(), 0);
+			m_uiGeneration = 1;
+		}
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether a Node's search values were set by the current search
+	///
+	/// \param kuiIndex Index of the Node to check
+	///
+	/// \return Whether the Node has been visited
+	///
+	/////////////////////////////////////////////////
+	bool isVisited(const unsigned int kuiIndex) const { return m_uiVisited[kuiIndex] == m_uiGeneration; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether a Node is on the closed list of the current search
+	///
+	/// \param kuiIndex Index of the Node to check
+	///
+	/// \return Whether the Node is closed
+	///
+	/////////////////////////////////////////////////
+	bool isClosed(const unsigned int kuiIndex) const { return m_uiClosed[kuiIndex] == m_uiGeneration; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the memory held by the buffer
+	///
+	/// \return Size in bytes
+	///
+	/////////////////////////////////////////////////
+	size_t getMemoryUsage() const
+	{
+		// Per Node G, H and F values, parents and generation stamps, plus the open list
+		return ((m_fG.capacity() + m_fH.capacity() + m_fF.capacity()) * sizeof(float)) +
+			((m_uiParents.capacity() + m_uiVisited.capacity() + m_uiClosed.capacity()) * sizeof(unsigned int)) +
+			m_openNodes.getMemoryUsage();
+	}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds a Node to the closed list of the current search
+	///
+	/// \param kuiIndex Index of the Node to close
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void close(const unsigned int kuiIndex) { m_uiClosed[kuiIndex] = m_uiGeneration; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Resets a Node's search values and stamps it as visited by the current search
+	///
+	/// \param kuiIndex Index of the Node to visit
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void visit(const unsigned int kuiIndex)
+	{
+		// Stamps the Node with the current generation
+		m_uiVisited[kuiIndex] = m_uiGeneration;
+
+		// Clears the existing parent Node
+		m_uiParents[kuiIndex] = g_kuiNoNode;
+
+		// Clears existing G/H/F values
+		m_fG[kuiIndex] = 0.f;
+		m_fH[kuiIndex] = 0.f;
+		m_fF[kuiIndex] = 0.f;
+	}
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+#ifndef SPAN_H
+#define SPAN_H
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for reading a run of contiguous items in place
+///
+/// Holds pointers to the first item and one past the last, so iterating
+/// copies nothing. The span is only valid while the storage it points
+/// into isn't resized.
+///
+/////////////////////////////////////////////////
+template <typename T>
+class Span
+{
+private:
+
+	T* m_pBegin; //!< First item in the span
+	T* m_pEnd; //!< One past the last item in the span
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param pBegin First item in the span
+	/// \param pEnd One past the last item in the span
+	///
+	/////////////////////////////////////////////////
+	Span(T* pBegin, T* pEnd) : m_pBegin(pBegin), m_pEnd(pEnd) {}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor, for reading a span of items as const
+	///
+	/// \param kOther Span over the same items
+	///
+	/////////////////////////////////////////////////
+	template <typename U>
+	Span(const Span<U>& kOther) : m_pBegin(kOther.begin()), m_pEnd(kOther.end()) {}
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the first item
+	///
+	/// \return Pointer to the first item
+	///
+	/////////////////////////////////////////////////
+	T* begin() const { return m_pBegin; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns one past the last item
+	///
+	/// \return Pointer past the last item
+	///
+	/////////////////////////////////////////////////
+	T* end() const { return m_pEnd; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns an item in the span
+	///
+	/// \param kuiIndex Index of the item from the start of the span
+	///
+	/// \return The item by reference
+	///
+	/////////////////////////////////////////////////
+	T& operator[](const unsigned int kuiIndex) const { return m_pBegin[kuiIndex]; }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns the number of items in the span
+	///
+	/// \return Item count
+	///
+	/////////////////////////////////////////////////
+	unsigned int size() const { return (unsigned int)(m_pEnd - m_pBegin); }
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Returns whether the span has no items
+	///
+	/// \return Whether it's empty
+	///
+	/////////////////////////////////////////////////
+	bool empty() const { return m_pBegin == m_pEnd; }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+#ifndef SPATIALHASH_H
+#define SPATIALHASH_H
+
+// Imports
+#include <SFML/System.hpp>
+#include <vector>
+#include <algorithm>
+#include <math.h>
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for finding the items near a point without visiting every item
+///
+/// The Environment is split into uniform square buckets. Each item is
+/// held in the bucket its centre is in, by its index in the owner's
+/// vector. Queries widen the circle by the largest item radius added, so
+/// they return every item the circle reaches, plus some that are close.
+///
+/////////////////////////////////////////////////
+class SpatialHash
+{
+private:
+
+	float m_fBucketSize; //!< Width and height of a bucket
+	unsigned int m_uiCols; //!< Count of buckets across the Environment
+	unsigned int m_uiRows; //!< Count of buckets down the Environment
+
+	std::vector<std::vector<unsigned int>> m_buckets; //!< Indices of the items in each bucket
+
+	float m_fMaxRadius = 0.0f; //!< Largest radius of an item added
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the column or row of the bucket a coordinate is in
+	///
+	/// \param kfCoord X or Y coordinate
+	/// \param kuiCount Count of columns or rows
+	///
+	/// \return The column or row, clamped to the Environment
+	///
+	/////////////////////////////////////////////////
+	unsigned int bucketCoord(const float kfCoord, const unsigned int kuiCount) const;
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the bucket a point is in
+	///
+	/// \param kPosition The point
+	///
+	/// \return Index of the bucket, points outside the Environment go in the nearest edge bucket
+	///
+	/////////////////////////////////////////////////
+	unsigned int bucketFromPos(const sf::Vector2f kPosition) const;
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param kSize Size of the Environment to cover
+	/// \param kfBucketSize Width and height of a bucket
+	///
+	/////////////////////////////////////////////////
+	SpatialHash(const sf::Vector2u kSize, const float kfBucketSize);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Adds an item
+	///
+	/// \param kuiItem Index of the item
+	/// \param kPosition Centre of the item
+	/// \param kfRadius Radius of the item
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void insert(const unsigned int kuiItem, const sf::Vector2f kPosition, const float kfRadius);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Moves an item to the bucket of its new centre
+	///
+	/// \param kuiItem Index of the item
+	/// \param kFrom Centre of the item when it was last added or moved
+	/// \param kTo New centre of the item
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void move(const unsigned int kuiItem, const sf::Vector2f kFrom, const sf::Vector2f kTo);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Finds the items that may reach within a radius of a point
+	///
+	/// \param kPosition Centre of the circle
+	/// \param kfRadius Radius of the circle
+	/// \param items Vector to fill with the indices found, in ascending order
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void query(const sf::Vector2f kPosition, const float kfRadius, std::vector<unsigned int>& items) const;
+};
+
+#endif
\ No newline at end of file
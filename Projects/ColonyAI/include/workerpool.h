@@ -0,0 +1,102 @@
+#pragma once
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+// Imports
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/////////////////////////////////////////////////
+///
+/// \brief Class for running a task over a range of indices on a pool of threads
+///
+/// The range is split into one contiguous share per thread, the calling
+/// thread taking the first. Tasks must only write to what their own index
+/// owns, so the result is the same whatever the number of threads.
+///
+/////////////////////////////////////////////////
+class WorkerPool
+{
+private:
+
+	std::vector<std::thread> m_workers; //!< Threads that run the shares after the first
+
+	std::function<void(const unsigned int)> m_task; //!< Task of the current job, run once per index
+	unsigned int m_uiCount = 0; //!< Count of indices in the current job
+	unsigned int m_uiJob = 0; //!< Counts the jobs started, so workers can tell when there's a new one
+	unsigned int m_uiBusy = 0; //!< Count of workers still running their share of the current job
+
+	std::mutex m_mutex; //!< Guards the job and counters
+	std::condition_variable m_jobStarted; //!< Signalled when a job starts or the pool stops
+	std::condition_variable m_shareFinished; //!< Signalled when a worker finishes its share
+
+	bool m_bStopping = false; //!< Whether the workers should exit
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Runs the task over one share of the current job's indices
+	///
+	/// \param kuiShare Index of the share, 0 for the calling thread
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void runShare(const unsigned int kuiShare);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Runs a share of each job until the pool stops, run by each worker
+	///
+	/// \param kuiShare Index of the share the worker runs
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void work(const unsigned int kuiShare);
+
+protected:
+
+public:
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Constructor
+	///
+	/// \param kuiWorkers Number of worker threads to start, alongside the calling thread
+	///
+	/////////////////////////////////////////////////
+	WorkerPool(const unsigned int kuiWorkers);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Destructor, stops and joins the workers
+	///
+	/////////////////////////////////////////////////
+	~WorkerPool();
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Runs a task for every index up to a count, returning once all have finished
+	///
+	/// \param kuiCount Count of indices
+	/// \param kTask Task to run with each index
+	///
+	/// \return void
+	///
+	/////////////////////////////////////////////////
+	void run(const unsigned int kuiCount, const std::function<void(const unsigned int)>& kTask);
+
+	/////////////////////////////////////////////////
+	///
+	/// \brief Gets the number of threads a job is shared between
+	///
+	/// \return Worker count plus the calling thread
+	///
+	/////////////////////////////////////////////////
+	unsigned int getThreadCount() const { return (unsigned int)m_workers.size() + 1; }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,123 @@
+/**
+@file astarsearch.cpp
+*/
+
+// Imports
+#include "astarsearch.h"
+
+// Constructor
+AStarSearch::AStarSearch(const NavGrid& kGrid, const CellGrid& kCells, const Heuristic kHeuristic, const Landmarks* kpLandmarks, std::ostream& log) : GridSearch(kGrid, kCells, kHeuristic, kpLandmarks, log)
+{
+}
+
+// SearchStatus: Expands an A* search from the current Node until it ends or the budget is spent - Returns whether the search is still going, found a path or failed
+SearchStatus AStarSearch::expand(SearchBuffer& buffer, unsigned int& uiCurrent, const unsigned int kuiTarget, const bool kbIgnoreAccess, unsigned int uiBudget, std::queue<sf::Vector2f>& path)
+{
+	// While a path has not been found
+	while (true)
+	{
+		///////////////////// Setting Up The Current Node /////////////////////
+
+		// If the budget is spent: yields with the current Node left to expand
+		if (uiBudget == 0) return SEARCHING;
+		uiBudget--;
+
+		// Counts the expansion
+		m_uiExpansions++;
+
+		// Sets the currentNode's heuristic as the estimated distance from the Node to the target
+		buffer.m_fH[uiCurrent] = heuristic(uiCurrent, kuiTarget, kbIgnoreAccess);
+
+		// If Current Node is actually the Target Node
+		if (uiCurrent == kuiTarget)
+		{
+			m_log << "[PATHFINDING] Generating path... CurrentNode equal to TargetNode." << std::endl;
+			return FAILED;
+		}
+
+		///////////////////// Calculating Open Adjacent Nodes /////////////////////
+
+		// For all adjacent nodes
+		for (unsigned int uiAdj : m_kCells.adjacentNodes<8>(uiCurrent, !kbIgnoreAccess))
+		{
+			// If not ignoring accessibility and If adjNode is inaccessible
+			if ((!kbIgnoreAccess) && (!isAccessible(uiAdj))) { /* Ignores inaccessible Nodes */ }
+
+			// Else If adjNode is the target destination
+			else if (uiAdj == kuiTarget)
+			{
+				// Resets the adjacent Node
+				buffer.visit(uiAdj);
+
+				// Sets adj parent to the current node
+				buffer.m_uiParents[uiAdj] = uiCurrent;
+				// Sets the adjNode's heuristic as the estimated distance from the Node to the target
+				buffer.m_fH[uiAdj] = heuristic(uiAdj, kuiTarget, kbIgnoreAccess);
+				// Sets the adjNode's G value
+				buffer.m_fG[uiAdj] = calcG(buffer, uiCurrent, uiAdj);
+				// Sets the adjNode's F value (G+H)
+				buffer.m_fF[uiAdj] = buffer.m_fG[uiAdj] + buffer.m_fH[uiAdj];
+
+				// Destination found, create path
+				path = queuePath(buffer, uiAdj);
+				m_log << "[PATHFINDING] Generating path... Finished." << std::endl;
+				return FOUND;
+			}
+
+			// Else if adjNode is on the closed list
+			else if (buffer.isClosed(uiAdj)) { /* Ignores Nodes already processed */ }
+
+			// Else If adjNode has been visited by this search but not closed, it is on the open list already
+			else if (buffer.isVisited(uiAdj))
+			{
+				// If (total movement cost to adjcent node through current Node) is less than (total movement cost to adjNode)
+				if (calcG(buffer, uiCurrent, uiAdj) < buffer.m_fG[uiAdj])
+				{
+					// Sets adj parent to the closed node
+					buffer.m_uiParents[uiAdj] = uiCurrent;
+					// Updates the adjNode's G and F values with the cheaper route
+					buffer.m_fG[uiAdj] = calcG(buffer, uiCurrent, uiAdj);
+					buffer.m_fF[uiAdj] = buffer.m_fG[uiAdj] + buffer.m_fH[uiAdj];
+
+					// Moves the adjNode up the open list
+					buffer.m_openNodes.decreaseKey(uiAdj, buffer.m_fF[uiAdj], buffer.m_fH[uiAdj]);
+				}
+			}
+
+			// Else: adjNode is accessible, not the destination and is not on the open or closed list
+			else
+			{
+				// Resets the adjacent Node
+				buffer.visit(uiAdj);
+
+				// Sets adj parent to the current node
+				buffer.m_uiParents[uiAdj] = uiCurrent;
+				// Sets the adjNode's heuristic as the estimated distance from the Node to the target
+				buffer.m_fH[uiAdj] = heuristic(uiAdj, kuiTarget, kbIgnoreAccess);
+				// Sets the adjNode's G value
+				buffer.m_fG[uiAdj] = calcG(buffer, uiCurrent, uiAdj);
+				// Sets the adjNode's F value (G+H)
+				buffer.m_fF[uiAdj] = buffer.m_fG[uiAdj] + buffer.m_fH[uiAdj];
+
+				// Add adjacent nodes to open list
+				buffer.m_openNodes.push(uiAdj, buffer.m_fF[uiAdj], buffer.m_fH[uiAdj]);
+			}
+		}
+
+		///////////////////// Determining Next Closed Node /////////////////////
+
+		// If there is an open list
+		if (!buffer.m_openNodes.empty())
+		{
+			// Pops the Node with the smallest F value (lowest H on ties) off the open list onto the closed list
+			uiCurrent = buffer.m_openNodes.pop();
+			buffer.close(uiCurrent);
+		}
+		// Else the open list is empty
+		else
+		{
+			m_log << "[PATHFINDING] Generating path... Error - No path found." << std::endl;
+			return FAILED;
+		}
+	}
+}
\ No newline at end of file
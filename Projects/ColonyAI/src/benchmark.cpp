@@ -0,0 +1,290 @@
+/**
+@file benchmark.cpp
+*/
+
+// Imports
+#include "benchmark.h"
+
+// Constructor
+Benchmark::Benchmark(const unsigned int kuiQueries, const unsigned int kuiSeed)
+{
+	// Sets member values to corresponding input
+	m_uiQueries = kuiQueries;
+	m_uiSeed = kuiSeed;
+}
+
+// Bool: Loads an Environment file and benchmarks Pathfinding within it - Returns whether the Environment was loaded successfully
+bool Benchmark::run(const std::string ksFilePath)
+{
+	// Instantiates new Environment
+	Environment environment = Environment();
+
+	// If the Environment fails to load: exit the method
+	if (!environment.loadFromFile(ksFilePath)) return false;
+
+	// Non-owning pointer to the Environment for Pathfinding
+	std::shared_ptr<Environment> pEnv(&environment, [](Environment*) {});
+
+	// Creates Pathfinding that knows of every Object
+	Pathfinding pathfinding(pEnv);
+	learnObjects(pEnv, pathfinding);
+
+	// Generates the queries
+	std::vector<Query> queries = generateQueries(pathfinding);
+
+	std::cout << "Benchmarking " << queries.size() << " queries on " << ksFilePath << " (seed " << m_uiSeed << ")" << std::endl;
+
+	// Silences Pathfinding logging while timing
+	std::streambuf* pPrevBuf = sf::err().rdbuf(nullptr);
+
+	// If Colonists were loaded: checks the first takes the landmark bounds with ALT once it knows every Object
+	if (!environment.getColonists().empty())
+	{
+		std::shared_ptr<Pathfinding> pColonistPathfinding = environment.getColonists().front()->getPathfinding();
+		pColonistPathfinding->setHeuristic(ALT);
+		learnObjects(pEnv, *pColonistPathfinding);
+		std::cout << "  loaded Colonist ALT: " << ((pColonistPathfinding->usesLandmarks()) ? "landmark bounds used" : "Error - landmark bounds unused") << std::endl;
+	}
+
+	// Runs the benchmark cases, emptying the path cache before each so every query is searched
+	pEnv->getPathCache()->clear();
+	runCase("A*", ASTAR, MANHATTAN, false, pathfinding, queries);
+	pEnv->getPathCache()->clear();
+	runCase("A* octile", ASTAR, OCTILE, false, pathfinding, queries);
+	pEnv->getPathCache()->clear();
+	runCase("A* ALT", ASTAR, ALT, false, pathfinding, queries);
+	pEnv->getPathCache()->clear();
+	runCase("A* smoothed", ASTAR, MANHATTAN, true, pathfinding, queries);
+	pEnv->getPathCache()->clear();
+	runCase("Bidirectional", BIDIRECTIONAL, MANHATTAN, false, pathfinding, queries);
+	pEnv->getPathCache()->clear();
+	runCase("Bidirectional octile", BIDIRECTIONAL, OCTILE, false, pathfinding, queries);
+	pEnv->getPathCache()->clear();
+	runCase("JPS", JPS, MANHATTAN, false, pathfinding, queries);
+	pEnv->getPathCache()->clear();
+	runCase("HPA*", HPA, MANHATTAN, false, pathfinding, queries);
+
+	// Sizes a search buffer as every searching thread would
+	SearchBuffer buffer;
+	buffer.prepare(pEnv->getNavGrid()->getNodeCount());
+
+	// Prints the resolution and the memory it cost, once the searches have filled in every table
+	std::cout << "  grid:              " << pEnv->getNavGrid()->getCols() << "x" << pEnv->getNavGrid()->getRows() << " Nodes of " << pEnv->getNavGrid()->getNodeDiameter() << "px" << std::endl;
+	std::cout << "  shared memory:     " << (pEnv->getNavGrid()->getMemoryUsage() + pEnv->getLandmarks()->getMemoryUsage()) / 1024 << "KB (grid and landmarks)" << std::endl;
+	std::cout << "  pooled buffers:    " << (pEnv->getReplanners()->getMemoryUsage() + pEnv->getSliceBuffers()->getMemoryUsage()) / 1024 << "KB (replanners and sliced searches not lent)" << std::endl;
+	std::cout << "  per Pathfinding:   " << pathfinding.getMemoryUsage() / 1024 << "KB (bits, clusters, path, lent buffers and flow fields)" << std::endl;
+	std::cout << "  per search thread: " << buffer.getMemoryUsage() / 1024 << "KB" << std::endl;
+
+	// Restores logging
+	sf::err().rdbuf(pPrevBuf);
+
+	return true;
+}
+
+// Void: Generates an Environment of scattered Objects and times its updates
+void Benchmark::runUpdates(const unsigned int kuiObjects, const unsigned int kuiUpdates)
+{
+	// Sizes the Environment to give each Object 80px by 80px, as dense as the large benchmark maps
+	const unsigned int kuiSize = (unsigned int)(80.0f * std::sqrt((float)kuiObjects));
+
+	// Object types to scatter, one of each in turn
+	const std::string kasTypes[] = { "Bush", "Rock", "Tree", "Water" };
+
+	// Seeds rand() so every run scatters the same Objects
+	srand(m_uiSeed);
+
+	// Writes the Environment as an Env file would hold it
+	std::stringstream envStream;
+	envStream << "Environment: x" << kuiSize << " y" << kuiSize << std::endl;
+	for (unsigned int i = 0; i < kuiObjects; i++)
+	{
+		envStream << "Object: " << kasTypes[i % 4] << " x" << (rand() % kuiSize) << " y" << (rand() % kuiSize) << " r" << (8 + (rand() % 13)) << std::endl;
+	}
+
+	std::cout << "Benchmarking " << kuiUpdates << " updates of " << kuiObjects << " Objects on a " << kuiSize << "x" << kuiSize << " Environment (seed " << m_uiSeed << ")" << std::endl;
+
+	// Silences logging while loading and timing
+	std::streambuf* pPrevBuf = sf::err().rdbuf(nullptr);
+
+	// Instantiates and loads the Environment
+	Environment environment = Environment();
+	environment.loadFromStream(envStream);
+
+	// Starts the clock
+	sf::Clock clock;
+
+	// Updates the Environment at 128 updates a second
+	for (unsigned int i = 0; i < kuiUpdates; i++) environment.update(1.0f / 128.0f);
+
+	// Defines the results
+	float fSeconds = clock.getElapsedTime().asSeconds();
+
+	// Prints the results
+	std::cout << "  Environment update:" << std::endl;
+	std::cout << "    entities:       " << environment.getEntities().size() << " by the end" << std::endl;
+	std::cout << "    total time:     " << fSeconds * 1000.0f << "ms" << std::endl;
+	if (kuiUpdates > 0) std::cout << "    per update:     " << (fSeconds * 1000000.0f) / kuiUpdates << "us" << std::endl;
+
+	// Restores logging
+	sf::err().rdbuf(pPrevBuf);
+}
+
+// Void: Generates an Environment of Colonists among scattered Objects and times its updates at each thread count
+void Benchmark::runThreads(const unsigned int kuiColonists, const unsigned int kuiUpdates)
+{
+	// Scatters twice as many Objects as Colonists, sizing the Environment as runUpdates does
+	const unsigned int kuiObjects = kuiColonists * 2;
+	const unsigned int kuiSize = (unsigned int)(80.0f * std::sqrt((float)kuiObjects));
+
+	// Object types to scatter, one of each in turn
+	const std::string kasTypes[] = { "Bush", "Rock", "Tree", "Water" };
+
+	// Seeds rand() so every run scatters the same Objects and Colonists
+	srand(m_uiSeed);
+
+	// Writes the Environment as an Env file would hold it
+	std::stringstream envStream;
+	envStream << "Environment: x" << kuiSize << " y" << kuiSize << std::endl;
+	for (unsigned int i = 0; i < kuiObjects; i++)
+	{
+		envStream << "Object: " << kasTypes[i % 4] << " x" << (rand() % kuiSize) << " y" << (rand() % kuiSize) << " r" << (8 + (rand() % 13)) << std::endl;
+	}
+	for (unsigned int i = 0; i < kuiColonists; i++)
+	{
+		envStream << "Entity: Colonist x" << (rand() % kuiSize) << " y" << (rand() % kuiSize) << " h" << ((rand() % 8) * 45) << std::endl;
+	}
+	const std::string ksEnv = envStream.str();
+
+	std::cout << "Benchmarking " << kuiUpdates << " updates of " << kuiColonists << " Colonists among " << kuiObjects << " Objects by thread count (seed " << m_uiSeed << ", " << std::thread::hardware_concurrency() << " cores)" << std::endl;
+
+	// Silences logging while loading and timing
+	std::streambuf* pPrevBuf = sf::err().rdbuf(nullptr);
+
+	// Time per update on the update thread alone, which the others are compared with
+	float fSingleUs = 0.0f;
+
+	// For each thread count
+	for (unsigned int uiThreads = 1; uiThreads <= 8; uiThreads *= 2)
+	{
+		// Loads the Environment fresh, with the Colonists choosing as they did on every other count
+		std::stringstream loadStream(ksEnv);
+		Environment environment = Environment();
+		environment.loadFromStream(loadStream);
+		environment.setUpdateThreads(uiThreads);
+		srand(m_uiSeed);
+
+		// Times the updates at 128 updates a second
+		sf::Clock clock;
+		for (unsigned int i = 0; i < kuiUpdates; i++) environment.update(1.0f / 128.0f);
+		const float kfUs = (kuiUpdates > 0) ? (clock.getElapsedTime().asSeconds() * 1000000.0f) / kuiUpdates : 0.0f;
+		if (uiThreads == 1) fSingleUs = kfUs;
+
+		// Prints the results
+		std::cout << "  " << uiThreads << " thread(s):" << std::endl;
+		std::cout << "    colonists:      " << environment.getColonists().size() << " by the end" << std::endl;
+		std::cout << "    per update:     " << kfUs << "us" << std::endl;
+		if (kfUs > 0.0f) std::cout << "    speedup:        " << fSingleUs / kfUs << "x" << std::endl;
+	}
+
+	// Restores logging
+	sf::err().rdbuf(pPrevBuf);
+}
+
+// Void: Marks every Object in the Environment as known to a Pathfinding
+void Benchmark::learnObjects(std::shared_ptr<Environment> pEnv, Pathfinding& pathfinding)
+{
+	// For all Objects in the Environment
+	for (const std::shared_ptr<Object>& pObject : pEnv->getObjects())
+	{
+		// Calculates Node accessibility with the Object
+		pathfinding.calcAccess(m_kfColonistRadius, pObject);
+	}
+}
+
+// std::vector<Query>: Generates queries between random accessible Nodes - Returns vector of queries
+std::vector<Query> Benchmark::generateQueries(Pathfinding& pathfinding)
+{
+	// Defines vector for result
+	std::vector<Query> queries;
+
+	// Vector of accessible Node indices to pick from
+	std::vector<unsigned int> accessible;
+	for (unsigned int uiIndex = 0; uiIndex < pathfinding.getNodeCount(); uiIndex++)
+	{
+		if (pathfinding.isAccessible(pathfinding.nodeFromIndex(uiIndex))) accessible.push_back(uiIndex);
+	}
+
+	// If no Nodes are accessible: no queries
+	if (accessible.empty()) return queries;
+
+	// Seeds rand() so every run uses the same queries
+	srand(m_uiSeed);
+
+	// For the number of queries
+	for (unsigned int i = 0; i < m_uiQueries; i++)
+	{
+		// Picks a random start and target
+		Query query;
+		query.m_start = pathfinding.nodeFromIndex(accessible.at(rand() % accessible.size())).getPosition();
+		query.m_uiTarget = accessible.at(rand() % accessible.size());
+
+		queries.push_back(query);
+	}
+
+	return queries;
+}
+
+// Void: Times a set of queries and prints the results
+void Benchmark::runCase(const std::string ksName, const SearchMode kMode, const Heuristic kHeuristic, const bool kbSmoothing, Pathfinding& pathfinding, const std::vector<Query>& kQueries)
+{
+	// Declares counters for the results
+	unsigned int uiFound = 0;
+	unsigned int uiWaypoints = 0;
+	unsigned int uiExpansions = pathfinding.getExpansions();
+	float fPathLength = 0.0f;
+
+	// Selects the algorithm
+	pathfinding.setSearchMode(kMode);
+	pathfinding.setHeuristic(kHeuristic);
+	pathfinding.setSmoothing(kbSmoothing);
+
+	// Starts the clock
+	sf::Clock clock;
+
+	// For all queries
+	for (const Query& kQuery : kQueries)
+	{
+		// Generates the path
+		pathfinding.setPath(pathfinding.createPathTo(kQuery.m_start, pathfinding.nodeFromIndex(kQuery.m_uiTarget), false));
+
+		// If a path was generated: count it
+		if (!pathfinding.getPath().empty())
+		{
+			uiFound++;
+
+			// Walks the path as a Colonist would, adding up its length
+			sf::Vector2f lastPoint = pathfinding.getPath().front();
+			while (!pathfinding.getPath().empty())
+			{
+				uiWaypoints++;
+				fPathLength += Utils::magnitude(pathfinding.getPath().front() - lastPoint);
+				lastPoint = pathfinding.getPath().front();
+				pathfinding.popPath();
+			}
+		}
+	}
+
+	// Defines the results
+	float fSeconds = clock.getElapsedTime().asSeconds();
+	uiExpansions = pathfinding.getExpansions() - uiExpansions;
+
+	// Prints the results
+	std::cout << "  " << ksName << ":" << std::endl;
+	std::cout << "    paths found:    " << uiFound << "/" << kQueries.size() << std::endl;
+	std::cout << "    expansions:     " << uiExpansions << std::endl;
+	std::cout << "    path length:    " << fPathLength << std::endl;
+	std::cout << "    waypoints:      " << uiWaypoints << std::endl;
+	std::cout << "    total time:     " << fSeconds * 1000.0f << "ms" << std::endl;
+	if (!kQueries.empty()) std::cout << "    per query:      " << (fSeconds * 1000.0f) / kQueries.size() << "ms" << std::endl;
+	if (fSeconds > 0.0f) std::cout << "    expansions/sec: " << (unsigned int)(uiExpansions / fSeconds) << std::endl;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+/**
+@file bidirectionalsearch.cpp
+*/
+
+// Imports
+#include "bidirectionalsearch.h"
+
+// Constructor
+BidirectionalSearch::BidirectionalSearch(const NavGrid& kGrid, const CellGrid& kCells, const Heuristic kHeuristic, const Landmarks* kpLandmarks, std::ostream& log) : GridSearch(kGrid, kCells, kHeuristic, kpLandmarks, log)
+{
+}
+
+// std::queue<sf::Vector2f>: Creates a path to target Node with A* run from both ends until they meet - Returns a queue of points that represent a route, empty if there is none
+std::queue<sf::Vector2f> BidirectionalSearch::search(SearchBuffer& forward, SearchBuffer& backward, const unsigned int kuiStart, const unsigned int kuiTarget, const bool kbIgnoreAccess)
+{
+	// Creates an empty path queue
+	std::queue<sf::Vector2f> nullPath;
+
+	// If Current Node is actually the Target Node
+	if (kuiStart == kuiTarget)
+	{
+		m_log << "[PATHFINDING] Generating path... CurrentNode equal to TargetNode." << std::endl;
+		return nullPath;
+	}
+
+	// Starts a search generation for the end at the target
+	backward.beginSearch();
+	backward.visit(kuiTarget);
+	backward.close(kuiTarget);
+
+	// Shortest path found through a Node both ends have reached, and that Node
+	float fBest = std::numeric_limits<float>::infinity();
+	unsigned int uiMeet = g_kuiNoNode;
+
+	// Expands the start and the target
+	m_uiExpansions += 2;
+	expandFromEnd(forward, backward, kuiStart, kuiTarget, kbIgnoreAccess, fBest, uiMeet);
+	expandFromEnd(backward, forward, kuiTarget, kuiStart, kbIgnoreAccess, fBest, uiMeet);
+
+	// While both ends have open Nodes
+	while ((!forward.m_openNodes.empty()) && (!backward.m_openNodes.empty()))
+	{
+		// If either end can't find anything shorter than the best path: it's optimal
+		if ((forward.m_openNodes.topF() >= fBest) || (backward.m_openNodes.topF() >= fBest)) break;
+
+		// Expands the end with the smaller open list
+		const bool kbForward = forward.m_openNodes.size() <= backward.m_openNodes.size();
+		SearchBuffer& buffer = (kbForward) ? forward : backward;
+		const unsigned int kuiNode = buffer.m_openNodes.pop();
+		buffer.close(kuiNode);
+
+		// Counts the expansion
+		m_uiExpansions++;
+
+		if (kbForward) expandFromEnd(forward, backward, kuiNode, kuiTarget, kbIgnoreAccess, fBest, uiMeet);
+		else expandFromEnd(backward, forward, kuiNode, kuiStart, kbIgnoreAccess, fBest, uiMeet);
+	}
+
+	// If the ends never met: there is no path
+	if (uiMeet == g_kuiNoNode)
+	{
+		m_log << "[PATHFINDING] Generating path... Error - No path found." << std::endl;
+		return nullPath;
+	}
+
+	// Queues the path from the start to where the ends met
+	std::queue<sf::Vector2f> path = queuePath(forward, uiMeet);
+
+	// Follows the target end's parents from where the ends met to the target
+	for (unsigned int uiNode = backward.m_uiParents[uiMeet]; uiNode != g_kuiNoNode; uiNode = backward.m_uiParents[uiNode])
+	{
+		path.push(m_kGrid.getPosition(uiNode));
+	}
+
+	m_log << "[PATHFINDING] Generating path... Finished." << std::endl;
+	return path;
+}
+
+// Void: Expands a Node for one end of a bidirectional search
+void BidirectionalSearch::expandFromEnd(SearchBuffer& buffer, const SearchBuffer& kOther, const unsigned int kuiNode, const unsigned int kuiGoal, const bool kbIgnoreAccess, float& fBest, unsigned int& uiMeet) const
+{
+	// For all adjacent nodes
+	for (unsigned int uiAdj : m_kCells.adjacentNodes<8>(kuiNode, !kbIgnoreAccess))
+	{
+		// If not ignoring accessibility and If adjNode is inaccessible, or it's on the closed list: ignores it
+		if (((!kbIgnoreAccess) && (!isAccessible(uiAdj))) || buffer.isClosed(uiAdj)) continue;
+
+		// Cost to the adjNode through this Node
+		const float kfG = calcG(buffer, kuiNode, uiAdj);
+
+		// If adjNode is new to this end
+		if (!buffer.isVisited(uiAdj))
+		{
+			// Resets the adjacent Node and sets its parent, G, H and F values
+			buffer.visit(uiAdj);
+			buffer.m_uiParents[uiAdj] = kuiNode;
+			buffer.m_fH[uiAdj] = heuristic(uiAdj, kuiGoal, kbIgnoreAccess);
+			buffer.m_fG[uiAdj] = kfG;
+			buffer.m_fF[uiAdj] = kfG + buffer.m_fH[uiAdj];
+
+			// Add adjacent nodes to open list
+			buffer.m_openNodes.push(uiAdj, buffer.m_fF[uiAdj], buffer.m_fH[uiAdj]);
+		}
+		// Else If this is a cheaper route to the adjNode
+		else if (kfG < buffer.m_fG[uiAdj])
+		{
+			// Updates the adjNode's parent, G and F values
+			buffer.m_uiParents[uiAdj] = kuiNode;
+			buffer.m_fG[uiAdj] = kfG;
+			buffer.m_fF[uiAdj] = kfG + buffer.m_fH[uiAdj];
+
+			// Moves the adjNode up the open list
+			buffer.m_openNodes.decreaseKey(uiAdj, buffer.m_fF[uiAdj], buffer.m_fH[uiAdj]);
+		}
+		// Else: the route isn't an improvement
+		else continue;
+
+		// If the other end has reached the adjNode and the path through it is the shortest yet: keeps it
+		if (kOther.isVisited(uiAdj) && (buffer.m_fG[uiAdj] + kOther.m_fG[uiAdj] < fBest))
+		{
+			fBest = buffer.m_fG[uiAdj] + kOther.m_fG[uiAdj];
+			uiMeet = uiAdj;
+		}
+	}
+}
\ No newline at end of file
@@ -59,9 +59,9 @@ void Bush::update(const float kfElapsedTime)
 		sf::Vector2f foodPos((Utils::unitVecFromAngle(fAngle)*m_fRadius) + m_position);
 
 		// Adds a Food Entity to the Environment
-		m_pEnvironment->getEntityVec()->push_back
+		m_pEnvironment->addEntity
 		(
-			std::shared_ptr<Entity>(new Food(m_pEnvironment, foodPos))
+			std::shared_ptr<Food>(new Food(m_pEnvironment, foodPos))
 		);
 
 		sf::err() << "[BUSH] Food produced at x(" << foodPos.x << ") y(" << foodPos.y << ")" << std::endl;
@@ -0,0 +1,83 @@
+/**
+@file cellgrid.cpp
+*/
+
+// Imports
+#include "cellgrid.h"
+
+// Constructor
+CellGrid::CellGrid(const unsigned int kuiCols, const unsigned int kuiRows)
+{
+	// Sets member values to corresponding input
+	m_uiCols = kuiCols;
+	m_uiRows = kuiRows;
+	m_uiPaddedCols = kuiCols + 2;
+
+	// Borders the grid with off grid cells, every Node inside starts accessible
+	m_cells.assign(m_uiPaddedCols * (kuiRows + 2), g_kucOffGrid);
+	for (unsigned int uiIndex = 0; uiIndex < getNodeCount(); uiIndex++) m_cells[cellOf(uiIndex)] = 0;
+}
+
+// Bool: Flags a Node as inaccessible - Returns whether the Node was accessible before
+bool CellGrid::block(const unsigned int kuiNode)
+{
+	// If the Node is already inaccessible: nothing changes
+	if (isBlocked(kuiNode)) return false;
+
+	// Flags the Node and counts it
+	m_cells[cellOf(kuiNode)] |= g_kucBlocked;
+	m_uiBlockedCount++;
+
+	return true;
+}
+
+// Bool: Determines whether the Node at a column and row can be walked on - Returns whether the Node is on the grid and accessible
+bool CellGrid::walkable(const int kiX, const int kiY) const
+{
+	// If outside the grid: not walkable
+	if ((kiX < 0) || (kiY < 0) || (kiX >= (int)m_uiCols) || (kiY >= (int)m_uiRows)) return false;
+
+	// Walkable if the Node is accessible
+	return !isBlocked((unsigned int)kiX + (m_uiCols * (unsigned int)kiY));
+}
+
+// Bool: Determines whether a step from a Node in a direction can be taken - Returns whether the step is open
+bool CellGrid::stepOpen(const int kiX, const int kiY, const int kiDX, const int kiDY) const
+{
+	// If the Node stepped to can't be walked on: closed
+	if (!walkable(kiX + kiDX, kiY + kiDY)) return false;
+
+	// If stepping diagonally: needs both orthogonal neighbours open
+	if ((kiDX != 0) && (kiDY != 0)) return walkable(kiX + kiDX, kiY) && walkable(kiX, kiY + kiDY);
+
+	return true;
+}
+
+// Bool: Determines whether a step between two neighbouring Nodes can be taken - Returns whether the step is open
+bool CellGrid::stepOpen(const unsigned int kuiFrom, const unsigned int kuiTo) const
+{
+	// Column and row of the Node stepped from
+	const int kiX = (int)(kuiFrom % m_uiCols);
+	const int kiY = (int)(kuiFrom / m_uiCols);
+
+	// Steps in the direction of the Node stepped to
+	return stepOpen(kiX, kiY, (int)(kuiTo % m_uiCols) - kiX, (int)(kuiTo / m_uiCols) - kiY);
+}
+
+// Bool: Determines whether every Node inaccessible in another grid is inaccessible here - Returns whether this grid's inaccessible Nodes include the other's
+bool CellGrid::covers(const CellGrid& kOther) const
+{
+	// If the grids differ: can't compare
+	if (kOther.m_cells.size() != m_cells.size()) return false;
+
+	// If the other grid has more inaccessible Nodes: can't be included
+	if (kOther.m_uiBlockedCount > m_uiBlockedCount) return false;
+
+	// For all cells: if inaccessible to the other grid but not to this one, it isn't included
+	for (unsigned int i = 0; i < m_cells.size(); i++)
+	{
+		if ((kOther.m_cells[i] & g_kucBlocked) && !(m_cells[i] & g_kucBlocked)) return false;
+	}
+
+	return true;
+}
\ No newline at end of file
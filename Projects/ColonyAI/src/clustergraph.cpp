@@ -0,0 +1,508 @@
+/**
+@file clustergraph.cpp
+*/
+
+// Imports
+#include "clustergraph.h"
+
+// Constructor
+ClusterGraph::ClusterGraph(std::shared_ptr<NavGrid> pGrid, const unsigned int kuiClusterSize)
+{
+	// Sets member values to corresponding input
+	m_pGrid = pGrid;
+	m_uiClusterSize = kuiClusterSize;
+
+	// Divides the grid into clusters, partial clusters cover the remainder
+	m_uiClusterCols = (m_pGrid->getCols() + m_uiClusterSize - 1) / m_uiClusterSize;
+	m_uiClusterRows = (m_pGrid->getRows() + m_uiClusterSize - 1) / m_uiClusterSize;
+}
+
+// Void: Builds every entrance and cached edge
+void ClusterGraph::build(const CellGrid& kCells)
+{
+	// Number of clusters
+	const unsigned int kuiClusters = m_uiClusterCols * m_uiClusterRows;
+
+	// Sizes the per cluster storage
+	m_rightEntrances.assign(kuiClusters, std::vector<Entrance>());
+	m_belowEntrances.assign(kuiClusters, std::vector<Entrance>());
+	m_clusterNodes.assign(kuiClusters, std::vector<unsigned int>());
+	m_clusterCosts.assign(kuiClusters, std::vector<float>());
+	m_touched.assign(kuiClusters, false);
+	m_bTouched = false;
+
+	// For all clusters: places the entrances on the borders to the right and below
+	for (unsigned int i = 0; i < kuiClusters; i++)
+	{
+		if ((i % m_uiClusterCols) + 1 < m_uiClusterCols) buildBorder(i, false, kCells);
+		if ((i / m_uiClusterCols) + 1 < m_uiClusterRows) buildBorder(i, true, kCells);
+	}
+
+	// For all clusters: caches the edges between the entrances
+	for (unsigned int i = 0; i < kuiClusters; i++) buildCluster(i, kCells);
+
+	m_bBuilt = true;
+}
+
+// Void: Flags the cluster of a Node as needing repair
+void ClusterGraph::touch(const unsigned int kuiNode)
+{
+	// If the graph hasn't been built: it'll see the change when it is
+	if (!m_bBuilt) return;
+
+	m_touched[clusterOf(kuiNode)] = true;
+	m_bTouched = true;
+}
+
+// Void: Rebuilds the entrances and edges of touched clusters and their neighbours
+void ClusterGraph::repair(const CellGrid& kCells)
+{
+	// If nothing was touched: nothing to repair
+	if (!m_bTouched) return;
+
+	// Clusters whose entrance Nodes may have changed
+	std::vector<bool> rebuild(m_touched.size(), false);
+
+	// For all touched clusters
+	for (unsigned int i = 0; i < m_touched.size(); i++)
+	{
+		if (!m_touched[i]) continue;
+
+		// Column and row of the cluster
+		const unsigned int kuiX = i % m_uiClusterCols;
+		const unsigned int kuiY = i / m_uiClusterCols;
+
+		// Replaces the entrances on all four borders
+		if (kuiX + 1 < m_uiClusterCols) { buildBorder(i, false, kCells); rebuild[i + 1] = true; }
+		if (kuiY + 1 < m_uiClusterRows) { buildBorder(i, true, kCells); rebuild[i + m_uiClusterCols] = true; }
+		if (kuiX > 0) { buildBorder(i - 1, false, kCells); rebuild[i - 1] = true; }
+		if (kuiY > 0) { buildBorder(i - m_uiClusterCols, true, kCells); rebuild[i - m_uiClusterCols] = true; }
+
+		rebuild[i] = true;
+		m_touched[i] = false;
+	}
+
+	// For all clusters that border a touched cluster: re-caches the edges
+	for (unsigned int i = 0; i < rebuild.size(); i++)
+	{
+		if (rebuild[i]) buildCluster(i, kCells);
+	}
+
+	m_bTouched = false;
+}
+
+// Bool: Determines whether a Node within a cluster can be walked on - Returns whether the Node is walkable
+bool ClusterGraph::walkable(const unsigned int kuiCluster, const int kiX, const int kiY, const CellGrid& kCells) const
+{
+	// Bounds of the cluster
+	const int kiMinX = (int)((kuiCluster % m_uiClusterCols) * m_uiClusterSize);
+	const int kiMinY = (int)((kuiCluster / m_uiClusterCols) * m_uiClusterSize);
+
+	// If outside the cluster or the grid: not walkable
+	if ((kiX < kiMinX) || (kiY < kiMinY) || (kiX >= kiMinX + (int)m_uiClusterSize) || (kiY >= kiMinY + (int)m_uiClusterSize)) return false;
+	if ((kiX >= (int)m_pGrid->getCols()) || (kiY >= (int)m_pGrid->getRows())) return false;
+
+	// Walkable if the Node is accessible
+	return !kCells.isBlocked((unsigned int)kiX + (m_pGrid->getCols() * (unsigned int)kiY));
+}
+
+// Void: Searches outward from a Node without leaving its cluster
+void ClusterGraph::searchCluster(const unsigned int kuiCluster, const unsigned int kuiStart, const unsigned int kuiTarget, const CellGrid& kCells)
+{
+	// Bounds of the cluster
+	const unsigned int kuiMinX = (kuiCluster % m_uiClusterCols) * m_uiClusterSize;
+	const unsigned int kuiMinY = (kuiCluster / m_uiClusterCols) * m_uiClusterSize;
+
+	// Clears the results of the last search
+	m_fLocalCosts.assign(m_uiClusterSize * m_uiClusterSize, std::numeric_limits<float>::infinity());
+	m_uiLocalParents.assign(m_uiClusterSize * m_uiClusterSize, g_kuiNoNode);
+
+	// Open list of costs and Node indices, cheapest first
+	typedef std::pair<float, unsigned int> OpenEntry;
+	std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<OpenEntry>> openNodes;
+
+	// Starts at the start Node
+	m_fLocalCosts[((kuiStart % m_pGrid->getCols()) - kuiMinX) + (m_uiClusterSize * ((kuiStart / m_pGrid->getCols()) - kuiMinY))] = 0.0f;
+	openNodes.push(OpenEntry(0.0f, kuiStart));
+
+	// While there are Nodes to expand
+	while (!openNodes.empty())
+	{
+		// Pops the cheapest Node
+		const OpenEntry kCurrent = openNodes.top();
+		openNodes.pop();
+
+		// If a cheaper route to the Node was already expanded: skip it
+		if (kCurrent.first > localCost(kuiCluster, kCurrent.second)) continue;
+
+		// Counts the expansion
+		m_uiExpansions++;
+
+		// If the target was reached: stop
+		if (kCurrent.second == kuiTarget) return;
+
+		// For all neighbours, diagonals only past accessible Nodes
+		for (const unsigned int kuiAdj : kCells.adjacentNodes<8>(kCurrent.second, true))
+		{
+			// If the neighbour can't be walked on or is outside the cluster: skip it
+			if (!walkable(kuiCluster, (int)(kuiAdj % m_pGrid->getCols()), (int)(kuiAdj / m_pGrid->getCols()), kCells)) continue;
+
+			// Cost to the neighbour through the current Node
+			const float kfCost = kCurrent.first + Utils::magnitude(m_pGrid->getPosition(kuiAdj) - m_pGrid->getPosition(kCurrent.second));
+
+			// Index of the neighbour within the cluster
+			const unsigned int kuiLocal = ((kuiAdj % m_pGrid->getCols()) - kuiMinX) + (m_uiClusterSize * ((kuiAdj / m_pGrid->getCols()) - kuiMinY));
+
+			// If the route is cheaper: records it
+			if (kfCost < m_fLocalCosts[kuiLocal])
+			{
+				m_fLocalCosts[kuiLocal] = kfCost;
+				m_uiLocalParents[kuiLocal] = kCurrent.second;
+				openNodes.push(OpenEntry(kfCost, kuiAdj));
+			}
+		}
+	}
+}
+
+// Float: Gets the cost to a Node from the last cluster search - Returns cost to the Node, infinity if it wasn't reached
+float ClusterGraph::localCost(const unsigned int kuiCluster, const unsigned int kuiNode) const
+{
+	// Bounds of the cluster
+	const unsigned int kuiMinX = (kuiCluster % m_uiClusterCols) * m_uiClusterSize;
+	const unsigned int kuiMinY = (kuiCluster / m_uiClusterCols) * m_uiClusterSize;
+
+	return m_fLocalCosts[((kuiNode % m_pGrid->getCols()) - kuiMinX) + (m_uiClusterSize * ((kuiNode / m_pGrid->getCols()) - kuiMinY))];
+}
+
+// Void: Places the entrances along the border after a cluster
+void ClusterGraph::buildBorder(const unsigned int kuiCluster, const bool kbBelow, const CellGrid& kCells)
+{
+	// Entrances of the border, replaced entirely
+	std::vector<Entrance>& entrances = kbBelow ? m_belowEntrances[kuiCluster] : m_rightEntrances[kuiCluster];
+	entrances.clear();
+
+	// Bounds of the cluster
+	const unsigned int kuiMinX = (kuiCluster % m_uiClusterCols) * m_uiClusterSize;
+	const unsigned int kuiMinY = (kuiCluster / m_uiClusterCols) * m_uiClusterSize;
+
+	// Length of the border, shorter for clusters at the edge of the grid
+	const unsigned int kuiLength = kbBelow ? std::min(m_uiClusterSize, m_pGrid->getCols() - kuiMinX) : std::min(m_uiClusterSize, m_pGrid->getRows() - kuiMinY);
+
+	// Start of the current run of crossable Node pairs
+	unsigned int uiRunStart = 0;
+	bool bInRun = false;
+
+	// For every Node pair along the border, plus one past the end to close the last run
+	for (unsigned int i = 0; i <= kuiLength; i++)
+	{
+		// Declares the Node pair on either side of the border
+		unsigned int uiNodeA = 0;
+		unsigned int uiNodeB = 0;
+		bool bCrossable = false;
+
+		// If within the border
+		if (i < kuiLength)
+		{
+			// Defines the pair, below or right of the cluster's last row or column
+			if (kbBelow)
+			{
+				uiNodeA = (kuiMinX + i) + (m_pGrid->getCols() * (kuiMinY + m_uiClusterSize - 1));
+				uiNodeB = uiNodeA + m_pGrid->getCols();
+			}
+			else
+			{
+				uiNodeA = (kuiMinX + m_uiClusterSize - 1) + (m_pGrid->getCols() * (kuiMinY + i));
+				uiNodeB = uiNodeA + 1;
+			}
+
+			// Crossable if both sides are accessible
+			bCrossable = (!kCells.isBlocked(uiNodeA)) && (!kCells.isBlocked(uiNodeB));
+		}
+
+		// If a run starts here
+		if (bCrossable && !bInRun)
+		{
+			uiRunStart = i;
+			bInRun = true;
+		}
+		// Else If a run ended before here
+		else if (!bCrossable && bInRun)
+		{
+			// Offsets along the border of the entrances to place
+			const unsigned int kuiRunLength = i - uiRunStart;
+			std::vector<unsigned int> offsets;
+
+			// Short runs get one entrance in the middle, long runs one at each end
+			if (kuiRunLength < 6) offsets.push_back(uiRunStart + (kuiRunLength / 2));
+			else
+			{
+				offsets.push_back(uiRunStart);
+				offsets.push_back(i - 1);
+			}
+
+			// For all entrances: adds the Node pair at the offset
+			for (unsigned int uiOffset : offsets)
+			{
+				Entrance entrance;
+				if (kbBelow)
+				{
+					entrance.m_uiNodeA = (kuiMinX + uiOffset) + (m_pGrid->getCols() * (kuiMinY + m_uiClusterSize - 1));
+					entrance.m_uiNodeB = entrance.m_uiNodeA + m_pGrid->getCols();
+				}
+				else
+				{
+					entrance.m_uiNodeA = (kuiMinX + m_uiClusterSize - 1) + (m_pGrid->getCols() * (kuiMinY + uiOffset));
+					entrance.m_uiNodeB = entrance.m_uiNodeA + 1;
+				}
+				entrances.push_back(entrance);
+			}
+
+			bInRun = false;
+		}
+	}
+}
+
+// Void: Gathers a cluster's entrance Nodes and caches the costs between them
+void ClusterGraph::buildCluster(const unsigned int kuiCluster, const CellGrid& kCells)
+{
+	// Entrance Nodes of the cluster, replaced entirely
+	std::vector<unsigned int>& nodes = m_clusterNodes[kuiCluster];
+	nodes.clear();
+
+	// Column and row of the cluster
+	const unsigned int kuiX = kuiCluster % m_uiClusterCols;
+	const unsigned int kuiY = kuiCluster / m_uiClusterCols;
+
+	// Gathers this cluster's side of the entrances on all four borders
+	for (const Entrance& kEntrance : m_rightEntrances[kuiCluster]) nodes.push_back(kEntrance.m_uiNodeA);
+	for (const Entrance& kEntrance : m_belowEntrances[kuiCluster]) nodes.push_back(kEntrance.m_uiNodeA);
+	if (kuiX > 0) for (const Entrance& kEntrance : m_rightEntrances[kuiCluster - 1]) nodes.push_back(kEntrance.m_uiNodeB);
+	if (kuiY > 0) for (const Entrance& kEntrance : m_belowEntrances[kuiCluster - m_uiClusterCols]) nodes.push_back(kEntrance.m_uiNodeB);
+
+	// Removes Nodes shared by two borders
+	std::sort(nodes.begin(), nodes.end());
+	nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+	// Caches the cost between every pair of entrance Nodes
+	const unsigned int kuiCount = (unsigned int)nodes.size();
+	std::vector<float>& costs = m_clusterCosts[kuiCluster];
+	costs.assign(kuiCount * kuiCount, std::numeric_limits<float>::infinity());
+
+	// For all entrance Nodes: searches the whole cluster once
+	for (unsigned int i = 0; i < kuiCount; i++)
+	{
+		searchCluster(kuiCluster, nodes[i], g_kuiNoNode, kCells);
+
+		for (unsigned int j = 0; j < kuiCount; j++) costs[(i * kuiCount) + j] = localCost(kuiCluster, nodes[j]);
+	}
+}
+
+// Void: Generates the entrance Nodes connected to an entrance Node and the cost to each
+void ClusterGraph::entranceEdges(const unsigned int kuiNode, std::vector<std::pair<unsigned int, float>>& edges) const
+{
+	// Cluster of the Node
+	const unsigned int kuiCluster = clusterOf(kuiNode);
+	const std::vector<unsigned int>& kNodes = m_clusterNodes[kuiCluster];
+
+	// Position of the Node within the cluster's entrance Nodes
+	std::vector<unsigned int>::const_iterator it = std::lower_bound(kNodes.begin(), kNodes.end(), kuiNode);
+
+	// If the Node isn't an entrance: no edges
+	if ((it == kNodes.end()) || (*it != kuiNode)) return;
+
+	// Adds the cached edges to the other entrances of the cluster
+	const unsigned int kuiCount = (unsigned int)kNodes.size();
+	const unsigned int kuiRow = (unsigned int)(it - kNodes.begin());
+	for (unsigned int j = 0; j < kuiCount; j++)
+	{
+		const float kfCost = m_clusterCosts[kuiCluster][(kuiRow * kuiCount) + j];
+		if ((j != kuiRow) && (kfCost < std::numeric_limits<float>::infinity())) edges.push_back(std::make_pair(kNodes[j], kfCost));
+	}
+
+	// Declares the borders of the cluster, each paired with whether the Node is on its first side
+	std::vector<std::pair<const std::vector<Entrance>*, bool>> borders;
+	borders.push_back(std::make_pair(&m_rightEntrances[kuiCluster], true));
+	borders.push_back(std::make_pair(&m_belowEntrances[kuiCluster], true));
+	if (kuiCluster % m_uiClusterCols > 0) borders.push_back(std::make_pair(&m_rightEntrances[kuiCluster - 1], false));
+	if (kuiCluster / m_uiClusterCols > 0) borders.push_back(std::make_pair(&m_belowEntrances[kuiCluster - m_uiClusterCols], false));
+
+	// For all borders: adds the edges across the entrances the Node is part of
+	for (const std::pair<const std::vector<Entrance>*, bool>& kBorder : borders)
+	{
+		for (const Entrance& kEntrance : *kBorder.first)
+		{
+			// The Node's side and the other side of the entrance
+			const unsigned int kuiSide = kBorder.second ? kEntrance.m_uiNodeA : kEntrance.m_uiNodeB;
+			const unsigned int kuiOther = kBorder.second ? kEntrance.m_uiNodeB : kEntrance.m_uiNodeA;
+
+			if (kuiSide == kuiNode) edges.push_back(std::make_pair(kuiOther, Utils::magnitude(m_pGrid->getPosition(kuiOther) - m_pGrid->getPosition(kuiNode))));
+		}
+	}
+}
+
+// std::vector<unsigned int>: Plans a route over the entrances between two Nodes - Returns indices of the waypoints from start to target, empty if there is no route
+std::vector<unsigned int> ClusterGraph::findRoute(const unsigned int kuiStart, const unsigned int kuiTarget, const CellGrid& kCells)
+{
+	// Builds or repairs the graph so it matches what's known
+	if (!m_bBuilt) build(kCells);
+	else repair(kCells);
+
+	// Defines vector for result
+	std::vector<unsigned int> route;
+
+	// Clusters of the start and target
+	const unsigned int kuiStartCluster = clusterOf(kuiStart);
+	const unsigned int kuiTargetCluster = clusterOf(kuiTarget);
+
+	// Connects the start to the entrances of its cluster
+	std::vector<std::pair<unsigned int, float>> startEdges;
+	searchCluster(kuiStartCluster, kuiStart, g_kuiNoNode, kCells);
+	for (unsigned int uiNode : m_clusterNodes[kuiStartCluster])
+	{
+		if (localCost(kuiStartCluster, uiNode) < std::numeric_limits<float>::infinity()) startEdges.push_back(std::make_pair(uiNode, localCost(kuiStartCluster, uiNode)));
+	}
+
+	// Connects the entrances of the target's cluster to the target
+	std::unordered_map<unsigned int, float> targetCosts;
+	searchCluster(kuiTargetCluster, kuiTarget, g_kuiNoNode, kCells);
+	for (unsigned int uiNode : m_clusterNodes[kuiTargetCluster])
+	{
+		if (localCost(kuiTargetCluster, uiNode) < std::numeric_limits<float>::infinity()) targetCosts[uiNode] = localCost(kuiTargetCluster, uiNode);
+	}
+
+	// Search state of the abstract Nodes
+	std::unordered_map<unsigned int, float> costs;
+	std::unordered_map<unsigned int, unsigned int> parents;
+	std::unordered_set<unsigned int> closedNodes;
+
+	// Open list of F values and Node indices, smallest F first
+	typedef std::pair<float, unsigned int> OpenEntry;
+	std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<OpenEntry>> openNodes;
+
+	// Starts at the start Node
+	costs[kuiStart] = 0.0f;
+	openNodes.push(OpenEntry(0.0f, kuiStart));
+
+	// Edges of the Node being expanded
+	std::vector<std::pair<unsigned int, float>> edges;
+
+	// While there are Nodes to expand
+	while (!openNodes.empty())
+	{
+		// Pops the Node with the smallest F value
+		const unsigned int kuiCurrent = openNodes.top().second;
+		openNodes.pop();
+
+		// If the Node was already expanded: skip it
+		if (!closedNodes.insert(kuiCurrent).second) continue;
+
+		// Counts the expansion
+		m_uiExpansions++;
+
+		// If the target was reached
+		if (kuiCurrent == kuiTarget)
+		{
+			// Walks the parents back to the start
+			for (unsigned int uiNode = kuiTarget; uiNode != kuiStart; uiNode = parents[uiNode]) route.push_back(uiNode);
+			route.push_back(kuiStart);
+
+			// Orders the route from the start
+			std::reverse(route.begin(), route.end());
+			return route;
+		}
+
+		// Gathers the edges of the Node
+		edges.clear();
+		if (kuiCurrent == kuiStart) edges = startEdges;
+		entranceEdges(kuiCurrent, edges);
+
+		// If the Node can reach the target within the target's cluster: adds that edge
+		if (clusterOf(kuiCurrent) == kuiTargetCluster)
+		{
+			std::unordered_map<unsigned int, float>::const_iterator it = targetCosts.find(kuiCurrent);
+			if (it != targetCosts.end()) edges.push_back(std::make_pair(kuiTarget, it->second));
+		}
+
+		// For all edges
+		for (const std::pair<unsigned int, float>& kEdge : edges)
+		{
+			// Cost to the connected Node through the current Node
+			const float kfCost = costs[kuiCurrent] + kEdge.second;
+
+			// If the route is new or cheaper: records it
+			std::unordered_map<unsigned int, float>::iterator it = costs.find(kEdge.first);
+			if ((it == costs.end()) || (kfCost < it->second))
+			{
+				costs[kEdge.first] = kfCost;
+				parents[kEdge.first] = kuiCurrent;
+
+				// Straight line distance to the target as the heuristic
+				const float kfH = Utils::magnitude(m_pGrid->getPosition(kuiTarget) - m_pGrid->getPosition(kEdge.first));
+				openNodes.push(OpenEntry(kfCost + kfH, kEdge.first));
+			}
+		}
+	}
+
+	// No route: return empty vector
+	return route;
+}
+
+// std::vector<unsigned int>: Refines one leg of a route into the Nodes to walk - Returns indices of the Nodes after the start up to and including the end, empty if the leg is blocked
+std::vector<unsigned int> ClusterGraph::refine(const unsigned int kuiFrom, const unsigned int kuiTo, const CellGrid& kCells)
+{
+	// Defines vector for result
+	std::vector<unsigned int> nodes;
+
+	// Cluster of the leg, both waypoints of a leg share one
+	const unsigned int kuiCluster = clusterOf(kuiFrom);
+
+	// If the waypoints are in different clusters: can't refine within one
+	if (clusterOf(kuiTo) != kuiCluster) return nodes;
+
+	// Searches the cluster for the end waypoint
+	searchCluster(kuiCluster, kuiFrom, kuiTo, kCells);
+
+	// If the end waypoint wasn't reached: the leg is blocked
+	if (localCost(kuiCluster, kuiTo) == std::numeric_limits<float>::infinity()) return nodes;
+
+	// Bounds of the cluster
+	const unsigned int kuiMinX = (kuiCluster % m_uiClusterCols) * m_uiClusterSize;
+	const unsigned int kuiMinY = (kuiCluster / m_uiClusterCols) * m_uiClusterSize;
+
+	// Walks the parents back to the start
+	for (unsigned int uiNode = kuiTo; uiNode != kuiFrom; uiNode = m_uiLocalParents[((uiNode % m_pGrid->getCols()) - kuiMinX) + (m_uiClusterSize * ((uiNode / m_pGrid->getCols()) - kuiMinY))])
+	{
+		nodes.push_back(uiNode);
+	}
+
+	// Orders the Nodes from the start
+	std::reverse(nodes.begin(), nodes.end());
+	return nodes;
+}
+
+// Bool: Returns whether two Nodes are in the same or neighbouring clusters - Returns whether the clusters are within one of each other
+bool ClusterGraph::clustersNear(const unsigned int kuiNodeA, const unsigned int kuiNodeB) const
+{
+	// Columns and rows of the clusters
+	const int kiAX = (int)(clusterOf(kuiNodeA) % m_uiClusterCols);
+	const int kiAY = (int)(clusterOf(kuiNodeA) / m_uiClusterCols);
+	const int kiBX = (int)(clusterOf(kuiNodeB) % m_uiClusterCols);
+	const int kiBY = (int)(clusterOf(kuiNodeB) / m_uiClusterCols);
+
+	return (abs(kiAX - kiBX) <= 1) && (abs(kiAY - kiBY) <= 1);
+}
+
+// Size_t: Gets the memory held by the entrances, cached costs and cluster search - Returns size in bytes
+size_t ClusterGraph::getMemoryUsage() const
+{
+	// Counts the buffers sized to the cluster search and the touched flags
+	size_t memory = (m_fLocalCosts.capacity() * sizeof(float)) + (m_uiLocalParents.capacity() * sizeof(unsigned int)) + (m_touched.capacity() / 8);
+
+	// For all clusters: counts its entrances, entrance Nodes and the costs between them
+	for (const std::vector<Entrance>& kEntrances : m_rightEntrances) memory += kEntrances.capacity() * sizeof(Entrance);
+	for (const std::vector<Entrance>& kEntrances : m_belowEntrances) memory += kEntrances.capacity() * sizeof(Entrance);
+	for (const std::vector<unsigned int>& kNodes : m_clusterNodes) memory += kNodes.capacity() * sizeof(unsigned int);
+	for (const std::vector<float>& kCosts : m_clusterCosts) memory += kCosts.capacity() * sizeof(float);
+
+	return memory;
+}
\ No newline at end of file
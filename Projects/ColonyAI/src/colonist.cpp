@@ -13,16 +13,18 @@ Colonist::Colonist(std::shared_ptr<Environment> pEnv, const sf::Vector2f kPositi
 
 	// Sets member values to corresponding input
 	m_pEnvironment = pEnv;
-	m_position = kPosition;
 	m_fHeading = kfHeading;
 	m_fRadius = 7.5f;
 	m_fVision = 125.0f;
 	m_fReach = m_fRadius*4;
 	m_fSpeed = 75.0f; // Should never exceed vision
-	m_fBirthCooldown = 15.0f;
 
-	// Defines fatal levels of hunger and thirst
-	m_needs = Needs(300.0f, 180.0f); // 5 minutes // 3 minutes
+	// Takes a slot in a component store of its own, until the Environment moves it into its store
+	m_pComponents = std::shared_ptr<ColonistComponents>(new ColonistComponents());
+
+	// Defines fatal levels of hunger and thirst, the birth cooldown, the position and the speed
+	m_uiSlot = m_pComponents->add(Needs(300.0f, 180.0f), 15.0f, kPosition, m_fSpeed); // 5 minutes // 3 minutes
+	bindPosition();
 
 	m_state = LABOUR; // Sets Colonist state to a default state: LABOUR
 
@@ -30,45 +32,51 @@ Colonist::Colonist(std::shared_ptr<Environment> pEnv, const sf::Vector2f kPositi
 	if (m_pEnvironment != nullptr)
 	{
 		m_pPathfinding = std::shared_ptr<Pathfinding>(new Pathfinding(m_pEnvironment));
+
+		// Long trips are planned over clusters and refined as they're walked
+		m_pPathfinding->setSearchMode(HPA);
+
+		// Waypoints that can be walked past in a straight line are removed
+		m_pPathfinding->setSmoothing(true);
+
+		// Landmark bounds are only admissible once every Object is known, which a Colonist rarely does
+		m_pPathfinding->setHeuristic(OCTILE);
+
+		// Plans on the worker threads while deciding, where sf::err() isn't safe to write to
+		m_pPathfinding->setLogging(false);
+
+		// Plans the route in the Colonist's path component
+		m_pPathfinding->setPathStore(m_pComponents->getPaths(), m_uiSlot);
 	}
 }
 
-// Void: Called to update the Colonist
-void Colonist::update(const float kfElapsedTime)
+// Void: Moves the Colonist's components into a store, taking a slot there
+void Colonist::setComponentStore(std::shared_ptr<ColonistComponents> pComponents)
+{
+	// Moves the components out of the current store
+	m_uiSlot = pComponents->take(*m_pComponents, m_uiSlot);
+	m_pComponents = pComponents;
+	bindPosition();
+
+	// Moves the path along with them
+	if (m_pPathfinding != nullptr) m_pPathfinding->setPathStore(m_pComponents->getPaths(), m_uiSlot);
+}
+
+// Void: Decides what the Colonist does this update, only changing itself
+void Colonist::decide()
 {
+	// What the Colonist can see was taken in by perceive, before every Colonist's new Memories were added
+
 	// If Colonist's not deceased
 	if (isAlive())
 	{
-		// Iterates Hunger
-		m_needs.setHunger(m_needs.getHunger() + kfElapsedTime);
-		m_needs.setThirst(m_needs.getThirst() + kfElapsedTime);
-
-		// Counts the birth cooldown down
-		if (m_fBirthCooldown > 0.0f) m_fBirthCooldown -= kfElapsedTime;
-		else if (m_fBirthCooldown < 0.0f) m_fBirthCooldown = 0.0f;
-
-		// Calculate the Colonist's 'home' position
-		// TEMPORARY - Currently ignores Memory entirely
-		unsigned int uiCount = 0;
-		sf::Vector2f sum;
-		// For all Objects
-		for (std::shared_ptr<Object> pObject : m_pEnvironment->getObjects())
-		{
-			// If Object is FoodSource or WaterSource
-			if (pObject->getType() == BUSH || pObject->getType() == WATER)
-			{
-				// Adds position to sum and iterates counter
-				sum += pObject->getPosition();
-				uiCount++;
-			}
-		}
-		// Home position = 0,0 (No sources in Environment)
-		if (uiCount == 0) m_homePos = sf::Vector2f(0.0f, 0.0f);
-		// Home position = avg position of all sources
-		else m_homePos = sum / (float)uiCount;
+		// Hunger, Thirst and the birth cooldown are grown by the Environment's needs system before Colonists decide
+
+		// Takes the 'home' position, the average position of every Food and Water source
+		m_homePos = m_pEnvironment->getHomePosition();
 
-		// Calls method to update Colonist Memory
-		updateMemory((long)time(NULL));
+		// Marks the Nodes made inaccessible by the Objects learned of
+		learn();
 		
 		// Calls method to update Colonist AI state
 		updateState();
@@ -80,33 +88,57 @@ void Colonist::update(const float kfElapsedTime)
 
 		case TENDTONEEDS: tendToNeeds(); break; // State: TendToNeeds - run method
 
-		case REPRODUCE: reproduce(); break; // State: Reproduce - run method
+		case REPRODUCE: m_bBirthPending = true; break; // State: Reproduce - the birth adds a Colonist, so it's committed in update
 
 		case LABOUR: labour(); break; // State: Labour - run method
 
 		default: m_state = LABOUR; break; // No valid state found: set LABOUR;
 	}
+}
 
-	// If path queue is not empty
-	if (!m_pPathfinding->getPath().empty())
+// Void: Commits what the Colonist decided with elapsed time
+void Colonist::update(const float kfElapsedTime)
+{
+	// If Colonist's not deceased
+	if (isAlive())
 	{
-		// Paths the Colonist to the pos at the front of the queue
-		if (moveTo(m_pPathfinding->getPath().front(), kfElapsedTime))
-		{
-			// Removes the location at the front of the queue
-			m_pPathfinding->popPath();
-		}
+		// Takes the path requested if it has been solved, following the current one until then, and spends the expansion budget shared in order
+		m_pPathfinding->collectPath();
+
+		// If the Colonist decided to reproduce: gives birth
+		if (m_bBirthPending) reproduce();
+
+		// Shares Memories with the Colonists seen
+		shareMemories();
+
+		// If the Colonist decided to explore: requests a path forward
+		if (m_bExplorePending) explore();
 	}
 
+	// Clears what was decided, it's been committed
+	m_bBirthPending = false;
+	m_bExplorePending = false;
+
+	// The path is followed by the Environment's movement system once the wave has updated
+
 	// Binds heading to 360 degrees
 	m_fHeading = Utils::bindNum(m_fHeading, 0, 360);
+
+	// Stops the needs system growing the Colonist's needs once it's deceased
+	m_pComponents->setAlive(m_uiSlot, isAlive());
 }
 
-// Void: Updates the Colonist's Memory
-void Colonist::updateMemory(const long klTime)
+// Void: Takes in what the Colonist can see, only reading the rest of the Environment
+void Colonist::perceive(const long klTime)
 {
-	// For all Objects in the Environment
-	for (std::shared_ptr<Object> pObject : m_pEnvironment->getObjects())
+	// Clears the Colonists seen last update, the Objects learned of are cleared once they're marked
+	m_pColonistsInVision.clear();
+
+	// If Colonist's deceased: it sees nothing
+	if (!isAlive()) return;
+
+	// For all Objects near enough the Colonist to be seen
+	for (const std::shared_ptr<Object>& pObject : m_pEnvironment->getObjectsNear(position(), m_fVision, m_nearby))
 	{
 		// If Object is within vision of the Colonist
 		if (inVision(pObject->getPosition(), pObject->getRadius()))
@@ -115,15 +147,28 @@ void Colonist::updateMemory(const long klTime)
 			bool bPosInMemory = false;
 
 			// For all existing Memories
-			for (std::shared_ptr<Memory> pMemory : m_pMemories)
+			for (Memory& memory : memories())
 			{
 				// If Memory Object exists and If Memory has the same position as Object
-				if ((pMemory->getType() != NULL_OBJECT) && (pMemory->getObject()->getPosition() == pObject->getPosition()))
+				if ((memory.getType() != NULL_OBJECT) && (memory.getObject()->getPosition() == pObject->getPosition()))
+				{
+					// Sets bPosInMem true
+					bPosInMemory = true;
+					// Updates Memory with new time
+					memory.setTime(klTime);
+				}
+			}
+
+			// For all Memories perceived this update, which aren't in the component store yet
+			for (Memory& memory : m_newMemories)
+			{
+				// If Memory has the same position as Object
+				if (memory.getObject()->getPosition() == pObject->getPosition())
 				{
 					// Sets bPosInMem true
 					bPosInMemory = true;
 					// Updates Memory with new time
-					pMemory->setTime(klTime);
+					memory.setTime(klTime);
 				}
 			}
 
@@ -145,83 +190,110 @@ void Colonist::updateMemory(const long klTime)
 				// If Object is Water
 				else if (pObject->getType() == WATER) { type = WATER_SOURCE; }
 
-				// Adds the position to memory with corresponding type
-				m_pMemories.push_back(std::shared_ptr<Memory>
-				(
-					new Memory(klTime, pObject, type))
-				);
+				// Holds the position with corresponding type, to be added to memory once every Colonist has perceived
+				m_newMemories.push_back(Memory(klTime, pObject, type));
 
-				// Calculates Node accessibility with new Memory Object
-				m_pPathfinding->calcAccess(m_fRadius, pObject->getPosition(), pObject->getRadius());
+				// Holds the Object for Node accessibility to be calculated with, which changes the path
+				m_pNewlySeen.push_back(pObject);
 			}
 		}
 	}
 
-	// For all Entities in the Environment
-	for (std::shared_ptr<Entity> pEntity : m_pEnvironment->getEntities())
+	// For all Entities near enough the Colonist to be seen
+	for (const std::shared_ptr<Entity>& pEntity : m_pEnvironment->getEntitiesNear(position(), m_fVision, m_nearby))
 	{
-		// If Entity is within vision of the Colonist
-		if (inVision(pEntity->getPosition(), pEntity->getRadius()))
+		// If Entity is a Colonist within vision of the Colonist
+		if ((pEntity->getType() == COLONIST) && inVision(pEntity->getPosition(), pEntity->getRadius()))
 		{
-			// If the Entity is a Colonist
-			if (pEntity->getType() == COLONIST)
+			// Holds the Colonist to share Memories with, its type says it is one
+			m_pColonistsInVision.push_back(std::static_pointer_cast<Colonist>(pEntity));
+		}
+	}
+}
+
+// Void: Adds the Memories perceived this update to the component store
+void Colonist::commitMemories()
+{
+	// For all Memories perceived this update
+	for (const Memory& kMemory : m_newMemories)
+	{
+		// Adds the Memory after the Colonist's others
+		m_pComponents->addMemory(m_uiSlot, kMemory);
+	}
+
+	// They're added
+	m_newMemories.clear();
+}
+
+// Void: Marks the Nodes made inaccessible by the Objects learned of since the Colonist last decided
+void Colonist::learn()
+{
+	// For all Objects seen or shared since the Colonist last decided
+	for (const std::shared_ptr<Object>& kpObject : m_pNewlySeen)
+	{
+		// Calculates Node accessibility with new Memory Object
+		m_pPathfinding->calcAccess(m_fRadius, kpObject);
+	}
+
+	// They're marked
+	m_pNewlySeen.clear();
+}
+
+// Void: Shares Memories with the Colonists seen this update
+void Colonist::shareMemories()
+{
+	// For all Colonists seen this update
+	for (const std::shared_ptr<Colonist>& pColonist : m_pColonistsInVision)
+	{
+		// If Colonist is alive
+		if (pColonist->isAlive())
+		{
+			// For all of their Memories, by index as adding to ours can move theirs
+			for (unsigned int i = 0; i < pColonist->getMemories().size(); i++)
 			{
-				// Casts the Entity to a Colonist
-				std::shared_ptr<Colonist> pColonist = std::dynamic_pointer_cast<Colonist>(pEntity);
+				// Copies their Memory, so it's unchanged if adding to ours moves theirs
+				const Memory kTheirMemory = pColonist->getMemories()[i];
+
+				// Declares bool; whether their Memory is in ours
+				bool bInTheirMem = false;
 
-				// If Colonist is alive
-				if (pColonist->isAlive())
+				// For all of our Memories
+				for (Memory& ourMemory : memories())
 				{
-					// For all of their Memories
-					for (std::shared_ptr<Memory> pTheirMemory : pColonist->getMemories())
+					// If our Memory is in theirs
+					if (ourMemory.getObject() == kTheirMemory.getObject())
 					{
-						// Declares bool; whether their Memory is in ours
-						bool bInTheirMem = false;
-
-						// For all of our Memories
-						for (std::shared_ptr<Memory> pOurMemory : m_pMemories)
-						{
-							// If our Memory is in theirs
-							if (pOurMemory->getObject() == pTheirMemory->getObject())
-							{
-								// Update our time to the most recent of the two
-								// This means the Memories are kept up to date
-								pOurMemory->setTime(Utils::max(pOurMemory->getTime(), pTheirMemory->getTime()));
-
-								// Sets true; their memory is in ours
-								bInTheirMem = true;
-							}
-						}
-
-						// If other Colonist's Memory isn't in our Memory
-						if (!bInTheirMem)
-						{
-							// Add their Memory to our Memory
-							// Note a new ptr is created instead of having two Colonists with the same Memory ptr
-							m_pMemories.push_back(std::shared_ptr<Memory>(pTheirMemory.get()));
-
-							// Calculates Node accessibility with new Memory Object
-							m_pPathfinding->calcAccess(m_fRadius, pTheirMemory->getObject()->getPosition(), pTheirMemory->getObject()->getRadius());
-						}
+						// Update our time to the most recent of the two
+						// This means the Memories are kept up to date
+						ourMemory.setTime(Utils::max(ourMemory.getTime(), kTheirMemory.getTime()));
+
+						// Sets true; their memory is in ours
+						bInTheirMem = true;
 					}
 				}
-			}
-			// Else
-			else 
-			{
-				// TEMPORARY - Need to add other Entity handling later with food, stone and lumber
+
+				// If other Colonist's Memory isn't in our Memory
+				if (!bInTheirMem)
+				{
+					// Add a copy of their Memory to our Memory
+					// Note the Memory is copied instead of having two Colonists with the same Memory
+					m_pComponents->addMemory(m_uiSlot, kTheirMemory);
+
+					// Holds the Object for Node accessibility to be calculated with when the Colonist next decides
+					m_pNewlySeen.push_back(kTheirMemory.getObject());
+				}
 			}
 		}
 	}
 
 	// For all existing Memories
-	for (std::shared_ptr<Memory> pMemory : m_pMemories)
+	for (Memory& memory : memories())
 	{
 		// If Memory Object is a nullptr and type is not set to NULL_OBJECT
-		if ((pMemory->getObject() == nullptr) && (pMemory->getType() != NULL_OBJECT))
+		if ((memory.getObject() == nullptr) && (memory.getType() != NULL_OBJECT))
 		{
 			// Updates Memory type to NULL_OBJECT
-			pMemory->setType(NULL_OBJECT);
+			memory.setType(NULL_OBJECT);
 		}
 	}
 }
@@ -231,21 +303,21 @@ void Colonist::updateState()
 {
 	// Tier 01 - Is the Colonist Dead
 	// If thirst or hunger is 100% of fatal level
-	if (m_needs.getHungerPerc() >= 100.0f || m_needs.getThirstPerc() >= 100.0f)
+	if (needs().getHungerPerc() >= 100.0f || needs().getThirstPerc() >= 100.0f)
 	{
 		m_state = DECEASED;
 	}
 
 	// Tier 02 - Is the Colonist dying
 	// If thirst or hunger is 75% of fatal level
-	else if (m_needs.getHungerPerc() >= 75.0f || m_needs.getThirstPerc() >= 75.0f)
+	else if (needs().getHungerPerc() >= 75.0f || needs().getThirstPerc() >= 75.0f)
 	{
 		m_state = TENDTONEEDS;
 	}
 
 	// Tier 03 - Is the Colonist well satisfied
 	// If thirst or hunger is less than 25% of fatal level and able to birth
-	else if ((m_needs.getHungerPerc() <= 25.0f && m_needs.getThirstPerc() <= 25.0f) && (m_fBirthCooldown == 0.0f))
+	else if ((needs().getHungerPerc() <= 25.0f && needs().getThirstPerc() <= 25.0f) && (m_pComponents->getBirthCooldown(m_uiSlot) == 0.0f))
 	{
 		m_state = REPRODUCE;
 	}
@@ -272,7 +344,7 @@ void Colonist::deceased()
 void Colonist::tendToNeeds()
 {
 	// If hunger is more dire than thirst
-	if (m_needs.getHungerPerc() > m_needs.getThirstPerc())
+	if (needs().getHungerPerc() > needs().getThirstPerc())
 	{
 		// TODO - Gotta modify to consume Food instead of replenishing with Bushes
 
@@ -280,12 +352,12 @@ void Colonist::tendToNeeds()
 		std::vector<std::shared_ptr<Bush>> pFoodInVision;
 
 		// If has vision of Bush Object
-		for (std::shared_ptr<Object> pObject : m_pEnvironment->getObjects(BUSH))
+		for (const std::shared_ptr<Bush>& pBush : m_pEnvironment->getBushesNear(position(), m_fVision, m_nearby))
 		{
 			// If Object is in vision
-			if (inVision(pObject->getPosition(), pObject->getRadius()))
+			if (inVision(pBush->getPosition(), pBush->getRadius()))
 			{
-				pFoodInVision.push_back(std::dynamic_pointer_cast<Bush>(pObject));
+				pFoodInVision.push_back(pBush);
 			}
 		}
 
@@ -297,68 +369,40 @@ void Colonist::tendToNeeds()
 			for (std::shared_ptr<Bush> pBush : pFoodInVision)
 			{
 				// If pWater is closer than pNearestWater
-				if (Utils::magnitude(pBush->getPosition() - m_position) - pBush->getRadius() <= Utils::magnitude(pNearestBush->getPosition() - m_position) - pNearestBush->getRadius())
+				if (Utils::magnitude(pBush->getPosition() - position()) - pBush->getRadius() <= Utils::magnitude(pNearestBush->getPosition() - position()) - pNearestBush->getRadius())
 				{
 					pNearestBush.swap(pBush);
 				}
 			}
 
-			// Determines nearest Node to source
-			std::vector<std::shared_ptr<Node>> pPerimeterNodes = m_pPathfinding->perimeterNodes(pNearestBush->getPosition(), pNearestBush->getRadius());
-			std::shared_ptr<Node> pNearestNode = pPerimeterNodes.front();
-			for (std::shared_ptr<Node> pNode : pPerimeterNodes)
+			// If path isn't leading to the Food source
+			if (!m_pPathfinding->pathLeadsTo(pNearestBush->getPosition(), pNearestBush->getRadius()))
 			{
-				// If pNode is closer than pNearestNode
-				if (Utils::magnitude(pNode->getPosition() - m_position) <= Utils::magnitude(pNearestNode->getPosition() - m_position))
-				{
-					pNearestNode.swap(pNode);
-				}
-			}
-
-			//	If destination Node doesn't exist
-			if (pNearestNode == nullptr) {}
-			// Destination Node exists and path isn't leading to Food source
-			else
-			{
-				// If path exists
-				if (!m_pPathfinding->getPath().empty())
-				{
-					// If path is leading to the Water source
-					if (m_pPathfinding->getPath().back() == pNearestNode->getPosition()) {}
-					else
-					{
-						// Generate path to Food Source
-						m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-					}
-				}
-				else
-				{
-					// Generate path to Food Source
-					m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-				}
+				// Generate path to Food Source by following its flow field
+				m_pPathfinding->setPath(m_pPathfinding->createFlowPath(position(), pNearestBush->getPosition(), pNearestBush->getRadius()));
 			}
 
 			// If Food source is within reach
 			if (inReach(pNearestBush->getPosition(), pNearestBush->getRadius()))
 			{
 				// Replenishes hunger 
-				m_needs.setHunger(0.0f);
+				needs().setHunger(0.0f);
 			}
 		}
 
 		// Else If has memory of a food source
-		else if (Memory::typeInMem(FOOD_SOURCE, m_pMemories))
+		else if (Memory::typeInMem(FOOD_SOURCE, memories()))
 		{
 			// Defines vector to store Food_Source memories
 			std::vector<std::shared_ptr<Bush>> pFoodSources;
 
 			// If has vision of food entity
-			for (std::shared_ptr<Memory> pMemory : m_pMemories)
+			for (const Memory& kMemory : memories())
 			{
 				// If Memory is Food_Source
-				if (pMemory->getType() == FOOD_SOURCE)
+				if (kMemory.getType() == FOOD_SOURCE)
 				{
-					pFoodSources.push_back(std::dynamic_pointer_cast<Bush>(pMemory->getObject()));
+					pFoodSources.push_back(std::static_pointer_cast<Bush>(kMemory.getObject()));
 				}
 			}
 
@@ -367,52 +411,24 @@ void Colonist::tendToNeeds()
 			for (std::shared_ptr<Bush> pBush : pFoodSources)
 			{
 				// If pBush is closer than pNearestBush
-				if (Utils::magnitude(pBush->getPosition() - m_position) - pBush->getRadius() <= Utils::magnitude(pNearestBush->getPosition() - m_position) - pNearestBush->getRadius())
+				if (Utils::magnitude(pBush->getPosition() - position()) - pBush->getRadius() <= Utils::magnitude(pNearestBush->getPosition() - position()) - pNearestBush->getRadius())
 				{
 					pNearestBush.swap(pBush);
 				}
 			}
 
-			// Determines nearest Node to source
-			std::vector<std::shared_ptr<Node>> pPerimeterNodes = m_pPathfinding->perimeterNodes(pNearestBush->getPosition(), pNearestBush->getRadius());
-			std::shared_ptr<Node> pNearestNode = pPerimeterNodes.front();
-			for (std::shared_ptr<Node> pNode : pPerimeterNodes)
-			{
-				// If pNode is closer than pNearestNode
-				if (Utils::magnitude(pNode->getPosition() - m_position) <= Utils::magnitude(pNearestNode->getPosition() - m_position))
-				{
-					pNearestNode.swap(pNode);
-				}
-			}
-
-			//	If destination Node doesn't exist
-			if (pNearestNode == nullptr) {}
-			// Destination Node exists and path isn't leading to Food source
-			else
+			// If path isn't leading to the Food source
+			if (!m_pPathfinding->pathLeadsTo(pNearestBush->getPosition(), pNearestBush->getRadius()))
 			{
-				// If path exists
-				if (!m_pPathfinding->getPath().empty())
-				{
-					// If path is leading to the Food source
-					if (m_pPathfinding->getPath().back() == pNearestNode->getPosition()) {}
-					else
-					{
-						// Generate path to Food Source
-						m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-					}
-				}
-				else
-				{
-					// Generate path to Food Source
-					m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-				}
+				// Generate path to Food Source by following its flow field
+				m_pPathfinding->setPath(m_pPathfinding->createFlowPath(position(), pNearestBush->getPosition(), pNearestBush->getRadius()));
 			}
 
 			// If Food source is within reach
 			if (inReach(pNearestBush->getPosition(), pNearestBush->getRadius()))
 			{
 				// Replenishes hunger 
-				m_needs.setHunger(0.0f);
+				needs().setHunger(0.0f);
 			}
 		}
 		// Else - No knowledge of food or source
@@ -429,12 +445,12 @@ void Colonist::tendToNeeds()
 		std::vector<std::shared_ptr<Water>> pWaterInVision;
 
 		// If has vision of Water object
-		for (std::shared_ptr<Object> pObject : m_pEnvironment->getObjects(WATER))
+		for (const std::shared_ptr<Water>& pWater : m_pEnvironment->getWatersNear(position(), m_fVision, m_nearby))
 		{
 			// If Entity is in vision
-			if (inVision(pObject->getPosition(), pObject->getRadius()))
+			if (inVision(pWater->getPosition(), pWater->getRadius()))
 			{
-				pWaterInVision.push_back(std::dynamic_pointer_cast<Water>(pObject));
+				pWaterInVision.push_back(pWater);
 			}
 		}
 
@@ -446,68 +462,40 @@ void Colonist::tendToNeeds()
 			for (std::shared_ptr<Water> pWater : pWaterInVision)
 			{
 				// If pWater is closer than pNearestWater
-				if (Utils::magnitude(pWater->getPosition() - m_position) - pWater->getRadius() <= Utils::magnitude(pNearestWater->getPosition() - m_position) - pNearestWater->getRadius())
+				if (Utils::magnitude(pWater->getPosition() - position()) - pWater->getRadius() <= Utils::magnitude(pNearestWater->getPosition() - position()) - pNearestWater->getRadius())
 				{
 					pNearestWater.swap(pWater);
 				}
 			}
 
-			// Determines nearest Node to source
-			std::vector<std::shared_ptr<Node>> pPerimeterNodes = m_pPathfinding->perimeterNodes(pNearestWater->getPosition(), pNearestWater->getRadius());
-			std::shared_ptr<Node> pNearestNode = pPerimeterNodes.front();
-			for (std::shared_ptr<Node> pNode : pPerimeterNodes)
+			// If path isn't leading to the Water source
+			if (!m_pPathfinding->pathLeadsTo(pNearestWater->getPosition(), pNearestWater->getRadius()))
 			{
-				// If pNode is closer than pNearestNode
-				if (Utils::magnitude(pNode->getPosition() - m_position) <= Utils::magnitude(pNearestNode->getPosition() - m_position))
-				{
-					pNearestNode.swap(pNode);
-				}
-			}
-
-			//	If destination Node doesn't exist
-			if (pNearestNode == nullptr) {}
-			// Destination Node exists and path isn't leading to Water source
-			else
-			{
-				// If path exists
-				if (!m_pPathfinding->getPath().empty())
-				{
-					// If path is leading to the Water source
-					if (m_pPathfinding->getPath().back() == pNearestNode->getPosition()) {}
-					else
-					{
-						// Generate path to Water Source
-						m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-					}
-				}
-				else
-				{
-					// Generate path to Water Source
-					m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-				}
+				// Generate path to Water Source by following its flow field
+				m_pPathfinding->setPath(m_pPathfinding->createFlowPath(position(), pNearestWater->getPosition(), pNearestWater->getRadius()));
 			}
 
 			// If Water source is within reach
 			if (inReach(pNearestWater->getPosition(), pNearestWater->getRadius()))
 			{
 				// Replenishes thirst 
-				m_needs.setThirst(0.0f);
+				needs().setThirst(0.0f);
 			}
 		}
 
 		// If has Memory of a Water source
-		else if (Memory::typeInMem(WATER_SOURCE, m_pMemories))
+		else if (Memory::typeInMem(WATER_SOURCE, memories()))
 		{
 			// Defines vector to store Water_Source memories
 			std::vector<std::shared_ptr<Water>> pWaterSources;
 
 			// If has vision of food entity
-			for (std::shared_ptr<Memory> pMemory : m_pMemories)
+			for (const Memory& kMemory : memories())
 			{
 				// If Memory is Food_Source
-				if (pMemory->getType() == WATER_SOURCE)
+				if (kMemory.getType() == WATER_SOURCE)
 				{
-					pWaterSources.push_back(std::dynamic_pointer_cast<Water>(pMemory->getObject()));
+					pWaterSources.push_back(std::static_pointer_cast<Water>(kMemory.getObject()));
 				}
 			}
 
@@ -516,52 +504,24 @@ void Colonist::tendToNeeds()
 			for (std::shared_ptr<Water> pWater : pWaterSources)
 			{
 				// If pWater is closer than pNearestWater
-				if (Utils::magnitude(pWater->getPosition() - m_position) - pWater->getRadius() <= Utils::magnitude(pNearestWater->getPosition() - m_position) - pNearestWater->getRadius())
+				if (Utils::magnitude(pWater->getPosition() - position()) - pWater->getRadius() <= Utils::magnitude(pNearestWater->getPosition() - position()) - pNearestWater->getRadius())
 				{
 					pNearestWater.swap(pWater);
 				}
 			}
 
-			// Determines nearest Node to source
-			std::vector<std::shared_ptr<Node>> pPerimeterNodes = m_pPathfinding->perimeterNodes(pNearestWater->getPosition(), pNearestWater->getRadius());
-			std::shared_ptr<Node> pNearestNode = pPerimeterNodes.front();
-			for (std::shared_ptr<Node> pNode : pPerimeterNodes)
+			// If path isn't leading to the Water source
+			if (!m_pPathfinding->pathLeadsTo(pNearestWater->getPosition(), pNearestWater->getRadius()))
 			{
-				// If pNode is closer than pNearestNode
-				if (Utils::magnitude(pNode->getPosition() - m_position) <= Utils::magnitude(pNearestNode->getPosition() - m_position))
-				{
-					pNearestNode.swap(pNode);
-				}
-			}
-
-			//	If destination Node doesn't exist
-			if (pNearestNode == nullptr) {}
-			// Destination Node exists and path isn't leading to Water source
-			else
-			{
-				// If path exists
-				if (!m_pPathfinding->getPath().empty()) 
-				{
-					// If path is leading to the Water source
-					if (m_pPathfinding->getPath().back() == pNearestNode->getPosition()) {}
-					else
-					{
-						// Generate path to Water Source
-						m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-					}
-				}
-				else
-				{
-					// Generate path to Water Source
-					m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-				}
+				// Generate path to Water Source by following its flow field
+				m_pPathfinding->setPath(m_pPathfinding->createFlowPath(position(), pNearestWater->getPosition(), pNearestWater->getRadius()));
 			}
 
 			// If Water source is within reach
 			if (inReach(pNearestWater->getPosition(), pNearestWater->getRadius()))
 			{
 				// Replenishes thirst 
-				m_needs.setThirst(0.0f);
+				needs().setThirst(0.0f);
 			}
 		}
 
@@ -578,19 +538,16 @@ void Colonist::tendToNeeds()
 void Colonist::reproduce()
 {
 	// Adds a cooldown to the Colonist before it can reproduce again
-	m_fBirthCooldown = 300.0f; // 5 Minute cooldown
+	m_pComponents->setBirthCooldown(m_uiSlot, 300.0f); // 5 Minute cooldown
 
 	// Creates a new Colonist Entity
-	std::shared_ptr<Colonist> pNewColonist(new Colonist(m_pEnvironment, m_position, m_fHeading));
+	std::shared_ptr<Colonist> pNewColonist(new Colonist(m_pEnvironment, position(), m_fHeading));
 	// Sets Colonist's knowledge to that of the parent
-	pNewColonist->setMemories(m_pMemories);
+	pNewColonist->setMemories(memories());
 	pNewColonist->setClearObjs(m_pClearObjs);
 
 	// Adds a new Colonist Entity to the Environment
-	m_pEnvironment->getEntityVec()->push_back
-	(
-		std::shared_ptr<Entity>(pNewColonist)
-	);
+	m_pEnvironment->addEntity(pNewColonist);
 
 	sf::err() << "[COLONIST] New Colonist produced at x(" << pNewColonist->getPosition().x << ") y(" << pNewColonist->getPosition().y << ") h(" << pNewColonist->getHeading() << ")" << std::endl;
 }
@@ -599,27 +556,27 @@ void Colonist::reproduce()
 void Colonist::labour()
 {
 	// If Food Entity in Memory - Collect Food and bring it back home
-	if (Memory::typeInMem(FOOD_ENTITY, m_pMemories))
+	if (Memory::typeInMem(FOOD_ENTITY, memories()))
 	{
 		// TODO - No implementation yet
 	}
 
 	// If Food/Water Source in Memory
-	else if ((Memory::typeInMem(FOOD_SOURCE, m_pMemories)) || (Memory::typeInMem(WATER_SOURCE, m_pMemories)))
+	else if ((Memory::typeInMem(FOOD_SOURCE, memories())) || (Memory::typeInMem(WATER_SOURCE, memories())))
 	{
 		// Vector of Memory objects that have no clear route from home
 		std::vector<std::shared_ptr<Object>> pUnclearRoutes;
 
 		// For all sources, determine whether path from home to source is not clear
-		for (std::shared_ptr<Memory> pMemory : m_pMemories)
+		for (const Memory& kMemory : memories())
 		{
-			if ((pMemory->getType() == FOOD_SOURCE) || (pMemory->getType() == WATER_SOURCE))
+			if ((kMemory.getType() == FOOD_SOURCE) || (kMemory.getType() == WATER_SOURCE))
 			{
 				// If route to source Object not clear
-				if (!routeClear(pMemory->getObject()))
+				if (!routeClear(kMemory.getObject()))
 				{
 					// Add to not clear vector
-					pUnclearRoutes.push_back(pMemory->getObject());
+					pUnclearRoutes.push_back(kMemory.getObject());
 				}
 			}
 		}
@@ -631,8 +588,8 @@ void Colonist::labour()
 			clearRoute(pUnclearRoutes.front());
 		}
 
-		// Else If path queue is empty - Explore Environment 
-		else if (m_pPathfinding->getPath().empty())
+		// Else If path queue is empty and no path is on its way - Explore Environment 
+		else if (m_pPathfinding->getPath().empty() && !m_pPathfinding->pathPending())
 		{
 			wander();
 		}
@@ -641,15 +598,15 @@ void Colonist::labour()
 	// Else - Explore Environment 
 	else
 	{
-		// If path queue is empty
-		if (m_pPathfinding->getPath().empty())
+		// If path queue is empty and no path is on its way
+		if (m_pPathfinding->getPath().empty() && !m_pPathfinding->pathPending())
 		{
 			wander();
 		}
 	}
 }
 
-// Void: Paths the Colonist forward with a random heading
+// Void: Paths the Colonist toward a source in vision, or decides to explore
 void Colonist::wander()
 {
 	// Defines vector to store Water in vision
@@ -658,162 +615,112 @@ void Colonist::wander()
 	std::vector<std::shared_ptr<Bush>> pFoodInVision;
 
 	// For all Water Objects
-	for (std::shared_ptr<Object> pObject : m_pEnvironment->getObjects(WATER))
+	for (const std::shared_ptr<Water>& pWater : m_pEnvironment->getWatersNear(position(), m_fVision, m_nearby))
 	{
 		// If Object is in vision
-		if (inVision(pObject->getPosition(), pObject->getRadius()))
+		if (inVision(pWater->getPosition(), pWater->getRadius()))
 		{
-			pWaterInVision.push_back(std::dynamic_pointer_cast<Water>(pObject));
+			pWaterInVision.push_back(pWater);
 		}
 	}
 	// For all Bush Objects
-	for (std::shared_ptr<Object> pObject : m_pEnvironment->getObjects(BUSH))
+	for (const std::shared_ptr<Bush>& pBush : m_pEnvironment->getBushesNear(position(), m_fVision, m_nearby))
 	{
 		// If Object is in vision
-		if (inVision(pObject->getPosition(), pObject->getRadius()))
+		if (inVision(pBush->getPosition(), pBush->getRadius()))
 		{
-			pFoodInVision.push_back(std::dynamic_pointer_cast<Bush>(pObject));
+			pFoodInVision.push_back(pBush);
 		}
 	}
 
 	// If Colonist's thirst is not greatly satisfied and there's Water in vision
-	if ((m_needs.getThirstPerc() >= 25) && (!pWaterInVision.empty()))
+	if ((needs().getThirstPerc() >= 25) && (!pWaterInVision.empty()))
 	{
 		// Determines nearest source
 		std::shared_ptr<Water> pNearestWater = pWaterInVision.front();
 		for (std::shared_ptr<Water> pWater : pWaterInVision)
 		{
 			// If pWater is closer than pNearestWater
-			if (Utils::magnitude(pWater->getPosition() - m_position) - pWater->getRadius() <= Utils::magnitude(pNearestWater->getPosition() - m_position) - pNearestWater->getRadius())
+			if (Utils::magnitude(pWater->getPosition() - position()) - pWater->getRadius() <= Utils::magnitude(pNearestWater->getPosition() - position()) - pNearestWater->getRadius())
 			{
 				pNearestWater.swap(pWater);
 			}
 		}
 
-		// Determines nearest Node to source
-		std::vector<std::shared_ptr<Node>> pPerimeterNodes = m_pPathfinding->perimeterNodes(pNearestWater->getPosition(), pNearestWater->getRadius());
-		std::shared_ptr<Node> pNearestNode = pPerimeterNodes.front();
-		for (std::shared_ptr<Node> pNode : pPerimeterNodes)
-		{
-			// If pNode is closer than pNearestNode
-			if (Utils::magnitude(pNode->getPosition() - m_position) <= Utils::magnitude(pNearestNode->getPosition() - m_position))
-			{
-				pNearestNode.swap(pNode);
-			}
-		}
-
-		//	If destination Node doesn't exist
-		if (pNearestNode == nullptr) {}
-		// Destination Node exists and path isn't leading to Water source
-		else
+		// If path isn't leading to the Water source
+		if (!m_pPathfinding->pathLeadsTo(pNearestWater->getPosition(), pNearestWater->getRadius()))
 		{
-			// If path exists
-			if (!m_pPathfinding->getPath().empty())
-			{
-				// If path is leading to the Water source
-				if (m_pPathfinding->getPath().back() == pNearestNode->getPosition()) {}
-				else
-				{
-					// Generate path to Water Source
-					m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-				}
-			}
-			else
-			{
-				// Generate path to Water Source
-				m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-			}
+			// Generate path to Water Source by following its flow field
+			m_pPathfinding->setPath(m_pPathfinding->createFlowPath(position(), pNearestWater->getPosition(), pNearestWater->getRadius()));
 		}
 
 		// If Water source is within reach
 		if (inReach(pNearestWater->getPosition(), pNearestWater->getRadius()))
 		{
 			// Replenishes thirst 
-			m_needs.setThirst(0.0f);
+			needs().setThirst(0.0f);
 		}
 	}
 	// If Colonist's hunger is not greatly satisfied and there's Food in vision
-	else if ((m_needs.getHungerPerc() >= 25) && (!pFoodInVision.empty()))
+	else if ((needs().getHungerPerc() >= 25) && (!pFoodInVision.empty()))
 	{
 		// Determines nearest source
 		std::shared_ptr<Bush> pNearestBush = pFoodInVision.front();
 		for (std::shared_ptr<Bush> pBush : pFoodInVision)
 		{
 			// If pWater is closer than pNearestWater
-			if (Utils::magnitude(pBush->getPosition() - m_position) - pBush->getRadius() <= Utils::magnitude(pNearestBush->getPosition() - m_position) - pNearestBush->getRadius())
+			if (Utils::magnitude(pBush->getPosition() - position()) - pBush->getRadius() <= Utils::magnitude(pNearestBush->getPosition() - position()) - pNearestBush->getRadius())
 			{
 				pNearestBush.swap(pBush);
 			}
 		}
 
-		// Determines nearest Node to source
-		std::vector<std::shared_ptr<Node>> pPerimeterNodes = m_pPathfinding->perimeterNodes(pNearestBush->getPosition(), pNearestBush->getRadius());
-		std::shared_ptr<Node> pNearestNode = pPerimeterNodes.front();
-		for (std::shared_ptr<Node> pNode : pPerimeterNodes)
+		// If path isn't leading to the Food source
+		if (!m_pPathfinding->pathLeadsTo(pNearestBush->getPosition(), pNearestBush->getRadius()))
 		{
-			// If pNode is closer than pNearestNode
-			if (Utils::magnitude(pNode->getPosition() - m_position) <= Utils::magnitude(pNearestNode->getPosition() - m_position))
-			{
-				pNearestNode.swap(pNode);
-			}
-		}
-
-		//	If destination Node doesn't exist
-		if (pNearestNode == nullptr) {}
-		// Destination Node exists and path isn't leading to Food source
-		else
-		{
-			// If path exists
-			if (!m_pPathfinding->getPath().empty())
-			{
-				// If path is leading to the Water source
-				if (m_pPathfinding->getPath().back() == pNearestNode->getPosition()) {}
-				else
-				{
-					// Generate path to Food Source
-					m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-				}
-			}
-			else
-			{
-				// Generate path to Food Source
-				m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, pNearestNode, false));
-			}
+			// Generate path to Food Source by following its flow field
+			m_pPathfinding->setPath(m_pPathfinding->createFlowPath(position(), pNearestBush->getPosition(), pNearestBush->getRadius()));
 		}
 
 		// If Food source is within reach
 		if (inReach(pNearestBush->getPosition(), pNearestBush->getRadius()))
 		{
 			// Replenishes hunger 
-			m_needs.setHunger(0.0f);
+			needs().setHunger(0.0f);
 		}
 	}
-	// Else - explore
+	// Else - explore, the random destination is picked in update
 	else
 	{
-		// Declares a cone that the randPos will sit within infront of the Colonist
-		float fCone = 60.0f;
-	
-		// Defines a random angle ((0 and fCone) - 30) so -30 to 30
-		float fRandomAngle = (rand() % (int)(fCone + 1)) - (fCone*0.5f);
-	
-		// Applies the delta heading
-		m_fHeading += fRandomAngle;
-	
-		// Defines the delta position with a unit vector from the heading
-		sf::Vector2f deltaPos = Utils::unitVecFromAngle(m_fHeading);
-		// Converts the delta position from a unit vector to a sizeable displacement with the Colonist speed
-		deltaPos *= m_fSpeed;
-	
-		// Creates the randomly determined destination position 
-		sf::Vector2f targetPos = m_position + deltaPos;
-	
-		// If destination is within the Environment
-		if (Utils::pointInArea(targetPos, sf::Vector2f(0, 0), m_pEnvironment->getSize()))
-		{
-			// Creates path to the destination
-			m_pPathfinding->setPath(m_pPathfinding->createPathTo(m_position, m_pPathfinding->nodeFromPos(targetPos), false));
-		}
+		m_bExplorePending = true;
+	}
+}
+
+// Void: Requests a path forward with a random heading
+void Colonist::explore()
+{
+	// Declares a cone that the randPos will sit within infront of the Colonist
+	float fCone = 60.0f;
+
+	// Defines a random angle ((0 and fCone) - 30) so -30 to 30
+	float fRandomAngle = (rand() % (int)(fCone + 1)) - (fCone*0.5f);
+
+	// Applies the delta heading
+	m_fHeading += fRandomAngle;
+
+	// Defines the delta position with a unit vector from the heading
+	sf::Vector2f deltaPos = Utils::unitVecFromAngle(m_fHeading);
+	// Converts the delta position from a unit vector to a sizeable displacement with the Colonist speed
+	deltaPos *= m_fSpeed;
+
+	// Creates the randomly determined destination position 
+	sf::Vector2f targetPos = position() + deltaPos;
+
+	// If destination is within the Environment
+	if (Utils::pointInArea(targetPos, sf::Vector2f(0, 0), m_pEnvironment->getSize()))
+	{
+		// Requests a path to the destination, followed once it arrives
+		m_pPathfinding->requestPathTo(position(), m_pPathfinding->nodeFromPos(targetPos), false);
 	}
 }
 
@@ -827,24 +734,24 @@ bool Colonist::routeClear(const std::shared_ptr<Object> kpObject)
 	std::queue<sf::Vector2f> path;
 
 	// Determines nearest Node to Object
-	std::vector<std::shared_ptr<Node>> pPerimeterNodes = m_pPathfinding->perimeterNodes(kpObject->getPosition(), kpObject->getRadius());
-	std::shared_ptr<Node> pNearestNode = pPerimeterNodes.front();
-	for (std::shared_ptr<Node> pNode : pPerimeterNodes)
+	std::vector<Node> perimeterNodes = m_pPathfinding->perimeterNodes(kpObject->getPosition(), kpObject->getRadius());
+	Node nearestNode;
+	for (const Node& kNode : perimeterNodes)
 	{
-		// If pNode is closer than pNearestNode
-		if (Utils::magnitude(pNode->getPosition() - m_position) <= Utils::magnitude(pNearestNode->getPosition() - m_position))
+		// If kNode is the first or closer than nearestNode
+		if ((!nearestNode.isValid()) || (Utils::magnitude(kNode.getPosition() - position()) <= Utils::magnitude(nearestNode.getPosition() - position())))
 		{
-			pNearestNode.swap(pNode);
+			nearestNode = kNode;
 		}
 	}
 
 	// If nearest Node doesn't exist
-	if (pNearestNode == nullptr) {}
+	if (!nearestNode.isValid()) {}
 	// Node exists
 	else
 	{
 		// Generate path to Object
-		path = m_pPathfinding->createPathTo(m_homePos, pNearestNode, true);
+		path = m_pPathfinding->createPathTo(m_homePos, nearestNode, true);
 	}
 
 	// If route crosses inaccessible nodes, get the Objects causing it
@@ -852,7 +759,7 @@ bool Colonist::routeClear(const std::shared_ptr<Object> kpObject)
 	for (unsigned int i = 0; i < path.size(); i++)
 	{
 		// If Node is inaccessible
-		if (!m_pPathfinding->nodeFromPos(pathDupe.back())->isAccessible())
+		if (!m_pPathfinding->isAccessible(m_pPathfinding->nodeFromPos(pathDupe.back())))
 		{
 			// TODO
 			// Get Object causing inacessibility
@@ -877,24 +784,24 @@ void Colonist::clearRoute(const std::shared_ptr<Object> kpObject)
 	std::queue<sf::Vector2f> path;
 
 	// Determines nearest Node to Object
-	std::vector<std::shared_ptr<Node>> pPerimeterNodes = m_pPathfinding->perimeterNodes(kpObject->getPosition(), kpObject->getRadius());
-	std::shared_ptr<Node> pNearestNode = pPerimeterNodes.front();
-	for (std::shared_ptr<Node> pNode : pPerimeterNodes)
+	std::vector<Node> perimeterNodes = m_pPathfinding->perimeterNodes(kpObject->getPosition(), kpObject->getRadius());
+	Node nearestNode;
+	for (const Node& kNode : perimeterNodes)
 	{
-		// If pNode is closer than pNearestNode
-		if (Utils::magnitude(pNode->getPosition() - m_position) <= Utils::magnitude(pNearestNode->getPosition() - m_position))
+		// If kNode is the first or closer than nearestNode
+		if ((!nearestNode.isValid()) || (Utils::magnitude(kNode.getPosition() - position()) <= Utils::magnitude(nearestNode.getPosition() - position())))
 		{
-			pNearestNode.swap(pNode);
+			nearestNode = kNode;
 		}
 	}
 
 	// If nearest Node doesn't exist
-	if (pNearestNode == nullptr) {}
+	if (!nearestNode.isValid()) {}
 	// Node exists
 	else
 	{
 		// Generate path to Object
-		path = m_pPathfinding->createPathTo(m_homePos, pNearestNode, true);
+		path = m_pPathfinding->createPathTo(m_homePos, nearestNode, true);
 	}
 
 	// If route crosses inaccessible nodes, get the Objects causing it
@@ -907,51 +814,34 @@ void Colonist::clearRoute(const std::shared_ptr<Object> kpObject)
 void Colonist::eat(std::shared_ptr<Food> pFood)
 {
 	// Hunger is completely replenished
-	m_needs.setHunger(0.0f); // TODO - May add a level of replenishment Food can restore instead of 100%
+	needs().setHunger(0.0f); // TODO - May add a level of replenishment Food can restore instead of 100%
 
 	// Removes the Food object pointer
 	pFood = nullptr;
 }
 
-// Bool: Moves the Colonist toward a destination at an input speed - Returns whether Colonist is at the destination
-bool Colonist::moveTo(const sf::Vector2f kDestination, const float kfElapsedTime)
+// Void: Follows up the movement system: moves the Colonist between spatial hash buckets and refines the path past a waypoint reached
+void Colonist::commitMovement()
 {
-	// Defines the distance between current and desired position
-	sf::Vector2f distance = kDestination - m_position;
-	
-	// Defines displacement with the distance normal and speed
-	sf::Vector2f displacement = Utils::normaliseVec(distance) * (m_fSpeed*kfElapsedTime);
-
-	// If the displacement is larger than the distance between positions
-	if (Utils::magnitude(displacement) >= Utils::magnitude(distance))
-	{
-		// Displacement is set to distance
-		m_position = kDestination;
-		// Return True (goal achieved)
-		return true;
-	}
-	// Else the distance is larger than the displacement
-	else 
-	{
-		// Applies displacement
-		m_position += displacement;
-	}
-	
-	// Return False (goal not achieved)
-	return false;
+	// If the Colonist moved: moves it between spatial hash buckets
+	const sf::Vector2f kFrom = m_pComponents->getMovedFrom(m_uiSlot);
+	if ((m_pEnvironment != nullptr) && (kFrom != position())) m_pEnvironment->moveEntity(this, kFrom);
+
+	// If a waypoint was reached: the path is refined past it, where the Colonist now stands
+	if (m_pComponents->reachedWaypoint(m_uiSlot)) m_pPathfinding->reachedWaypoint(position());
 }
 
 // Bool: Whether the position is within vision
 bool Colonist::inVision(const sf::Vector2f kPosition, const float kfRadius)
 {
-	if (Utils::magnitude(kPosition - m_position) - kfRadius < m_fVision) return true;
+	if (Utils::magnitude(kPosition - position()) - kfRadius < m_fVision) return true;
 	return false;
 }
 
 // Bool: Whether the position is within reach
 bool Colonist::inReach(const sf::Vector2f kPosition, const float kfRadius)
 {
-	if (Utils::magnitude(kPosition - m_position) - kfRadius < m_fReach) return true;
+	if (Utils::magnitude(kPosition - position()) - kfRadius < m_fReach) return true;
 	return false;
 }
 
@@ -970,7 +860,7 @@ void Colonist::draw(sf::RenderTarget& target, sf::RenderStates states) const
 	// Sets the origin to the center of the circle
 	circle.setOrigin(sf::Vector2f(m_fRadius, m_fRadius));
 	// Sets the circle pos to position member
-	circle.setPosition(sf::Vector2f(m_position));
+	circle.setPosition(sf::Vector2f(position()));
 
 	// Draws circle to target
 	target.draw(circle);
@@ -988,9 +878,9 @@ void Colonist::draw(sf::RenderTarget& target, sf::RenderStates states) const
 		else colour = sf::Color(80, 80, 80, 255);
 
 		// Sets the first point of the line at the Colonist position
-		line[0] = sf::Vertex(m_position, colour);
+		line[0] = sf::Vertex(position(), colour);
 		// Sets the second point of the line infront of the Colonist based on heading
-		line[1] = sf::Vertex(m_position + (Utils::unitVecFromAngle(m_fHeading) * (m_fRadius*2.0f)), colour);
+		line[1] = sf::Vertex(position() + (Utils::unitVecFromAngle(m_fHeading) * (m_fRadius*2.0f)), colour);
 
 		// Draws the line to target
 		target.draw(line, 2, sf::Lines);
@@ -1009,7 +899,7 @@ void Colonist::draw(sf::RenderTarget& target, sf::RenderStates states) const
 		// Sets the origin to the center of the circle
 		circle.setOrigin(sf::Vector2f(m_fVision, m_fVision));
 		// Sets the circle pos to position member
-		circle.setPosition(m_position);
+		circle.setPosition(position());
 
 		// Draws circle to target
 		target.draw(circle);
@@ -1028,7 +918,7 @@ void Colonist::draw(sf::RenderTarget& target, sf::RenderStates states) const
 		// Sets the origin to the center of the circle
 		circle.setOrigin(sf::Vector2f(m_fReach, m_fReach));
 		// Sets the circle pos to position member
-		circle.setPosition(m_position);
+		circle.setPosition(position());
 
 		// Draws circle to target
 		target.draw(circle);
@@ -1037,7 +927,7 @@ void Colonist::draw(sf::RenderTarget& target, sf::RenderStates states) const
 		// Sets the colour to translucent black
 		colour = sf::Color(0, 0, 0, 75);
 		// Sets the first point of the line at the Colonist position
-		line[0] = sf::Vertex(m_position, colour);
+		line[0] = sf::Vertex(position(), colour);
 		// Sets the second point of the line at the Home position
 		line[1] = sf::Vertex(m_homePos, colour);
 
@@ -1046,7 +936,7 @@ void Colonist::draw(sf::RenderTarget& target, sf::RenderStates states) const
 
 		///////////////////// MEMORY /////////////////////
 		// For all Memories
-		for (std::shared_ptr<Memory> pMemory : m_pMemories)
+		for (const Memory& kMemory : memories())
 		{
 			// Sets circle colour: Transparent with blue outline
 			circle.setFillColor(sf::Color(0, 0, 0, 0));
@@ -1054,11 +944,11 @@ void Colonist::draw(sf::RenderTarget& target, sf::RenderStates states) const
 			circle.setOutlineThickness(1.0f);
 
 			// Sets the circle radius to radius member
-			circle.setRadius(pMemory->getObject()->getRadius());
+			circle.setRadius(kMemory.getObject()->getRadius());
 			// Sets the origin to the center of the circle
-			circle.setOrigin(sf::Vector2f(pMemory->getObject()->getRadius(), pMemory->getObject()->getRadius()));
+			circle.setOrigin(sf::Vector2f(kMemory.getObject()->getRadius(), kMemory.getObject()->getRadius()));
 			// Sets the circle pos to position member
-			circle.setPosition(pMemory->getObject()->getPosition());
+			circle.setPosition(kMemory.getObject()->getPosition());
 
 			// Draws circle to target
 			target.draw(circle);
@@ -1066,9 +956,9 @@ void Colonist::draw(sf::RenderTarget& target, sf::RenderStates states) const
 			// Sets the colour to translucent blue
 			colour = sf::Color(0, 0, 255, 75);
 			// Sets the first point of the line at the Colonist position
-			line[0] = sf::Vertex(m_position, colour);
+			line[0] = sf::Vertex(position(), colour);
 			// Sets the second point of the line at the Memory position
-			line[1] = sf::Vertex(pMemory->getObject()->getPosition(), colour);
+			line[1] = sf::Vertex(kMemory.getObject()->getPosition(), colour);
 
 			// Draws the line to target
 			target.draw(line, 2, sf::Lines);
@@ -1076,7 +966,7 @@ void Colonist::draw(sf::RenderTarget& target, sf::RenderStates states) const
 
 		///////////////////// PATHFINDING /////////////////////
 		// Draws pathfinding info
-		m_pPathfinding->draw(m_position, target);
+		m_pPathfinding->draw(position(), target);
 
 		///////////////////// NEEDS /////////////////////
 		// Declares new RectShape to draw need bars
@@ -1093,14 +983,14 @@ void Colonist::draw(sf::RenderTarget& target, sf::RenderStates states) const
 		rect.setOrigin(sf::Vector2f(rect.getSize().x, rect.getSize().y));
 
 		// Sets the rect pos to above the Colonist
-		rect.setPosition(sf::Vector2f(m_position.x + rect.getSize().x*0.5f, (m_position.y - m_fRadius - rect.getSize().y*0.5f)));
+		rect.setPosition(sf::Vector2f(position().x + rect.getSize().x*0.5f, (position().y - m_fRadius - rect.getSize().y*0.5f)));
 		// Draws rect to target
 		target.draw(rect);
 
 		// Sets the rect to red
 		rect.setFillColor(sf::Color(255, 0, 0, 255));
 		// Sets the rect size
-		rect.setSize(sf::Vector2f(barSize.x*(m_needs.getThirstPerc() / 100), barSize.y));
+		rect.setSize(sf::Vector2f(barSize.x*(needs().getThirstPerc() / 100), barSize.y));
 		// Sets the origin to the center of the rect
 		rect.setOrigin(sf::Vector2f(rect.getSize().x, rect.getSize().y));
 
@@ -1116,14 +1006,14 @@ void Colonist::draw(sf::RenderTarget& target, sf::RenderStates states) const
 		rect.setOrigin(sf::Vector2f(rect.getSize().x, rect.getSize().y));
 
 		// Sets the rect pos to above the Colonist
-		rect.setPosition(sf::Vector2f(m_position.x + rect.getSize().x*0.5f, (m_position.y - m_fRadius - rect.getSize().y*0.5f) - rect.getSize().y*1.5f));
+		rect.setPosition(sf::Vector2f(position().x + rect.getSize().x*0.5f, (position().y - m_fRadius - rect.getSize().y*0.5f) - rect.getSize().y*1.5f));
 		// Draws rect to target
 		target.draw(rect);
 
 		// Sets the rect to red
 		rect.setFillColor(sf::Color(255, 0, 0, 255));
 		// Sets the rect size
-		rect.setSize(sf::Vector2f(barSize.x*(m_needs.getHungerPerc() / 100), barSize.y));
+		rect.setSize(sf::Vector2f(barSize.x*(needs().getHungerPerc() / 100), barSize.y));
 		// Sets the origin to the center of the rect
 		rect.setOrigin(sf::Vector2f(rect.getSize().x, rect.getSize().y));
 
@@ -0,0 +1,180 @@
+/**
+@file colonistcomponents.cpp
+*/
+
+// Imports
+#include "colonistcomponents.h"
+#include "utils.h"
+
+// Unsigned Int: Adds a Colonist's components, with no path or Memories - Returns slot of the new Colonist
+unsigned int ColonistComponents::add(const Needs& kNeeds, const float kfBirthCooldown, const sf::Vector2f kPosition, const float kfSpeed)
+{
+	// Every component gets an entry at the new slot
+	m_needs.push_back(kNeeds);
+	m_birthCooldowns.push_back(kfBirthCooldown);
+	m_alive.push_back(1);
+	m_positions.push_back(kPosition);
+	m_speeds.push_back(kfSpeed);
+	m_movedFrom.push_back(kPosition);
+	m_reachedWaypoint.push_back(0);
+	m_pPaths->push_back(Path());
+
+	// The span of Memories starts empty at the end of the vector, taking room as Memories are added
+	m_memoryOffsets.push_back((unsigned int)m_memories.size());
+	m_memoryCounts.push_back(0);
+	m_memoryCapacities.push_back(0);
+
+	return (unsigned int)m_needs.size() - 1;
+}
+
+// Unsigned Int: Moves a Colonist's components out of another store into a new slot - Returns slot of the Colonist in this store
+unsigned int ColonistComponents::take(ColonistComponents& other, const unsigned int kuiSlot)
+{
+	// Every component gets an entry at the new slot, moved from the other store
+	m_needs.push_back(other.m_needs[kuiSlot]);
+	m_birthCooldowns.push_back(other.m_birthCooldowns[kuiSlot]);
+	m_alive.push_back(other.m_alive[kuiSlot]);
+	m_positions.push_back(other.m_positions[kuiSlot]);
+	m_speeds.push_back(other.m_speeds[kuiSlot]);
+	m_movedFrom.push_back(other.m_movedFrom[kuiSlot]);
+	m_reachedWaypoint.push_back(other.m_reachedWaypoint[kuiSlot]);
+	m_pPaths->push_back(std::move((*other.m_pPaths)[kuiSlot]));
+
+	// The Memories are moved into a span at the end of the vector, with room for just them
+	const unsigned int kuiOffset = (unsigned int)m_memories.size();
+	const unsigned int kuiCount = other.m_memoryCounts[kuiSlot];
+	for (unsigned int i = 0; i < kuiCount; i++)
+	{
+		m_memories.push_back(std::move(other.m_memories[other.m_memoryOffsets[kuiSlot] + i]));
+	}
+	m_memoryOffsets.push_back(kuiOffset);
+	m_memoryCounts.push_back(kuiCount);
+	m_memoryCapacities.push_back(kuiCount);
+
+	// The other store's span is left empty
+	other.m_memoryCounts[kuiSlot] = 0;
+
+	return (unsigned int)m_needs.size() - 1;
+}
+
+// Void: Adds a Memory to the end of a Colonist's span
+void ColonistComponents::addMemory(const unsigned int kuiSlot, const Memory kMemory)
+{
+	// If the span is full: gives it more room
+	if (m_memoryCounts[kuiSlot] == m_memoryCapacities[kuiSlot]) growMemories(kuiSlot);
+
+	// Places the Memory after the span's last
+	m_memories[m_memoryOffsets[kuiSlot] + m_memoryCounts[kuiSlot]] = kMemory;
+	m_memoryCounts[kuiSlot]++;
+}
+
+// Void: Gives a Colonist's span of Memories twice the room, moving it to the end of the vector if it can't grow in place
+void ColonistComponents::growMemories(const unsigned int kuiSlot)
+{
+	const unsigned int kuiOffset = m_memoryOffsets[kuiSlot];
+	const unsigned int kuiCapacity = m_memoryCapacities[kuiSlot];
+
+	// Twice the room, starting with room for a few Memories
+	const unsigned int kuiNewCapacity = (kuiCapacity > 0) ? kuiCapacity * 2 : 4;
+
+	// If the span ends the vector: it grows in place
+	if (kuiOffset + kuiCapacity == m_memories.size())
+	{
+		m_memories.resize(kuiOffset + kuiNewCapacity);
+	}
+	// Else the span moves to the end of the vector, leaving its room behind
+	else
+	{
+		const unsigned int kuiNewOffset = (unsigned int)m_memories.size();
+		m_memories.resize(kuiNewOffset + kuiNewCapacity);
+
+		// Moves the Memories over, clearing those left behind so they don't hold their Objects
+		for (unsigned int i = 0; i < m_memoryCounts[kuiSlot]; i++)
+		{
+			m_memories[kuiNewOffset + i] = std::move(m_memories[kuiOffset + i]);
+			m_memories[kuiOffset + i] = Memory();
+		}
+
+		m_memoryOffsets[kuiSlot] = kuiNewOffset;
+		m_uiUnusedMemories += kuiCapacity;
+	}
+
+	m_memoryCapacities[kuiSlot] = kuiNewCapacity;
+
+	// If more than half the vector was left behind by moves: packs the spans together again
+	if (m_uiUnusedMemories * 2 > m_memories.size()) packMemories();
+}
+
+// Void: Packs the spans of Memories together in slot order, reclaiming the room left behind by moves
+void ColonistComponents::packMemories()
+{
+	// Vector to pack into, each span keeping its room
+	std::vector<Memory> packed;
+	packed.reserve(m_memories.size() - m_uiUnusedMemories);
+
+	// For every Colonist in slot order
+	for (unsigned int uiSlot = 0; uiSlot < m_memoryOffsets.size(); uiSlot++)
+	{
+		const unsigned int kuiOffset = (unsigned int)packed.size();
+
+		// Moves the Memories over, then the span's spare room
+		for (unsigned int i = 0; i < m_memoryCounts[uiSlot]; i++) packed.push_back(std::move(m_memories[m_memoryOffsets[uiSlot] + i]));
+		packed.resize(kuiOffset + m_memoryCapacities[uiSlot]);
+
+		m_memoryOffsets[uiSlot] = kuiOffset;
+	}
+
+	m_memories.swap(packed);
+	m_uiUnusedMemories = 0;
+}
+
+// Void: Grows the Hunger and Thirst and counts down the reproduction cooldown of living Colonists
+void ColonistComponents::updateNeeds(const unsigned int kuiFirst, const unsigned int kuiEnd, const float kfElapsedTime)
+{
+	// For every Colonist in the range
+	for (unsigned int i = kuiFirst; i < kuiEnd; i++)
+	{
+		// If the Colonist's deceased: its needs no longer change
+		if (!m_alive[i]) continue;
+
+		// Iterates Hunger and Thirst
+		m_needs[i].setHunger(m_needs[i].getHunger() + kfElapsedTime);
+		m_needs[i].setThirst(m_needs[i].getThirst() + kfElapsedTime);
+
+		// Counts the birth cooldown down
+		if (m_birthCooldowns[i] > 0.0f) m_birthCooldowns[i] -= kfElapsedTime;
+		else if (m_birthCooldowns[i] < 0.0f) m_birthCooldowns[i] = 0.0f;
+	}
+}
+
+// Void: Moves Colonists toward the next waypoint of their paths, removing it once reached
+void ColonistComponents::updateMovement(const unsigned int kuiFirst, const unsigned int kuiEnd, const float kfElapsedTime)
+{
+	// For every Colonist in the range
+	for (unsigned int i = kuiFirst; i < kuiEnd; i++)
+	{
+		// Stores the position before moving, to move the Colonist between spatial hash buckets
+		m_movedFrom[i] = m_positions[i];
+		m_reachedWaypoint[i] = 0;
+
+		// If the path is empty: the Colonist stays put
+		Path& path = (*m_pPaths)[i];
+		if (path.empty()) continue;
+
+		// Defines the distance between current and desired position
+		const sf::Vector2f kDistance = path.front() - m_positions[i];
+
+		// Defines displacement with the distance normal and speed
+		const sf::Vector2f kDisplacement = Utils::normaliseVec(kDistance) * (m_speeds[i] * kfElapsedTime);
+
+		// If the displacement is larger than the distance between positions: the waypoint is reached and removed
+		if (Utils::magnitude(kDisplacement) >= Utils::magnitude(kDistance))
+		{
+			m_positions[i] = path.front();
+			path.pop();
+			m_reachedWaypoint[i] = 1;
+		}
+		// Else the distance is larger than the displacement: applies it
+		else m_positions[i] += kDisplacement;
+	}
+}
\ No newline at end of file
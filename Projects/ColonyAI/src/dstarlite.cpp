@@ -0,0 +1,175 @@
+/**
+@file dstarlite.cpp
+*/
+
+// Imports
+#include "dstarlite.h"
+
+// Constructor
+DStarLite::DStarLite(std::shared_ptr<NavGrid> pGrid)
+{
+	// Sets member values to corresponding input
+	m_pGrid = pGrid;
+}
+
+// std::vector<unsigned int>: Plans from a start to a goal, reusing the last plan if the goal is the same - Returns indices of the Nodes from start to goal, empty if the goal can't be reached
+std::vector<unsigned int> DStarLite::plan(const unsigned int kuiStart, const unsigned int kuiGoal, const std::vector<unsigned int>& kChanged, const CellGrid& kCells)
+{
+	// Defines vector for result
+	std::vector<unsigned int> path;
+
+	// If either Node is outside the grid: no plan
+	if ((kuiStart >= m_pGrid->getNodeCount()) || (kuiGoal >= m_pGrid->getNodeCount())) return path;
+
+	// If planning to a new goal: starts the search again
+	if (kuiGoal != m_uiGoal)
+	{
+		m_uiGoal = kuiGoal;
+		m_uiStart = kuiStart;
+		m_fKeyModifier = 0.0f;
+
+		// Every Node starts unreached
+		m_fG.assign(m_pGrid->getNodeCount(), std::numeric_limits<float>::infinity());
+		m_fRhs.assign(m_pGrid->getNodeCount(), std::numeric_limits<float>::infinity());
+		m_openNodes.resize(m_pGrid->getNodeCount());
+
+		// The goal costs nothing to reach from itself
+		m_fRhs[m_uiGoal] = 0.0f;
+		m_openNodes.push(m_uiGoal, heuristic(m_uiStart, m_uiGoal), 0.0f);
+	}
+	// Else: repairs the last plan
+	else
+	{
+		// Raises the keys by how far the start has moved
+		m_fKeyModifier += heuristic(m_uiStart, kuiStart);
+		m_uiStart = kuiStart;
+
+		// For all changed Nodes
+		for (unsigned int uiChanged : kChanged)
+		{
+			// Steps into the Node and diagonals past it have changed, so the Node and its neighbours are updated
+			updateNode(uiChanged, kCells);
+			for (unsigned int uiAdj : kCells.adjacentNodes<8>(uiChanged, false)) updateNode(uiAdj, kCells);
+		}
+	}
+
+	// Expands Nodes until the cost from the start is known
+	computePath(kCells);
+
+	// If the goal can't be reached from the start: no plan
+	if (m_fG[m_uiStart] == std::numeric_limits<float>::infinity()) return path;
+
+	// Follows the cheapest steps from the start to the goal
+	unsigned int uiCurrent = m_uiStart;
+	path.push_back(uiCurrent);
+	while ((uiCurrent != m_uiGoal) && (path.size() <= m_pGrid->getNodeCount()))
+	{
+		// Determines the neighbour with the cheapest cost to the goal through it
+		unsigned int uiNext = g_kuiNoNode;
+		float fBest = std::numeric_limits<float>::infinity();
+		for (unsigned int uiAdj : kCells.adjacentNodes<8>(uiCurrent, false))
+		{
+			float fCost = cost(uiCurrent, uiAdj, kCells) + m_fG[uiAdj];
+			if (fCost < fBest)
+			{
+				fBest = fCost;
+				uiNext = uiAdj;
+			}
+		}
+
+		// If every step is blocked: no plan
+		if (uiNext == g_kuiNoNode) return std::vector<unsigned int>();
+
+		uiCurrent = uiNext;
+		path.push_back(uiCurrent);
+	}
+
+	return path;
+}
+
+// Void: Expands Nodes until the cost from the start is known
+void DStarLite::computePath(const CellGrid& kCells)
+{
+	// While the open list has Nodes
+	while (!m_openNodes.empty())
+	{
+		// Key of the start
+		const float kfStartMin = std::min(m_fG[m_uiStart], m_fRhs[m_uiStart]);
+		const float kfStartKey = kfStartMin + m_fKeyModifier;
+
+		// If the top Node can't improve the start and the start is settled: done
+		if (((m_openNodes.topF() > kfStartKey) || ((m_openNodes.topF() == kfStartKey) && (m_openNodes.topH() >= kfStartMin))) && (m_fG[m_uiStart] == m_fRhs[m_uiStart])) return;
+
+		// Counts the expansion
+		m_uiExpansions++;
+
+		// Takes the top Node and its key as it is now
+		const unsigned int kuiNode = m_openNodes.top();
+		const float kfOldF = m_openNodes.topF();
+		const float kfMin = std::min(m_fG[kuiNode], m_fRhs[kuiNode]);
+		const float kfNewF = kfMin + heuristic(m_uiStart, kuiNode) + m_fKeyModifier;
+
+		// If the key is out of date since the start moved: requeues it
+		if (kfOldF < kfNewF)
+		{
+			m_openNodes.update(kuiNode, kfNewF, kfMin);
+		}
+		// Else If a cheaper cost has been found: settles it and updates the Nodes that step into it
+		else if (m_fG[kuiNode] > m_fRhs[kuiNode])
+		{
+			m_fG[kuiNode] = m_fRhs[kuiNode];
+			m_openNodes.remove(kuiNode);
+			for (unsigned int uiAdj : kCells.adjacentNodes<8>(kuiNode, false)) updateNode(uiAdj, kCells);
+		}
+		// Else the cost has risen: unsettles it and updates it and the Nodes that step into it
+		else
+		{
+			m_fG[kuiNode] = std::numeric_limits<float>::infinity();
+			updateNode(kuiNode, kCells);
+			for (unsigned int uiAdj : kCells.adjacentNodes<8>(kuiNode, false)) updateNode(uiAdj, kCells);
+		}
+	}
+}
+
+// Void: Recalculates a Node's Rhs and places it on or off the open list
+void DStarLite::updateNode(const unsigned int kuiNode, const CellGrid& kCells)
+{
+	// If the Node isn't the goal
+	if (kuiNode != m_uiGoal)
+	{
+		// Rhs is the cheapest step to a neighbour plus the neighbour's cost
+		m_fRhs[kuiNode] = std::numeric_limits<float>::infinity();
+		for (unsigned int uiAdj : kCells.adjacentNodes<8>(kuiNode, false)) m_fRhs[kuiNode] = std::min(m_fRhs[kuiNode], cost(kuiNode, uiAdj, kCells) + m_fG[uiAdj]);
+	}
+
+	// If the Node is settled: takes it off the open list
+	if (m_fG[kuiNode] == m_fRhs[kuiNode])
+	{
+		if (m_openNodes.contains(kuiNode)) m_openNodes.remove(kuiNode);
+	}
+	// Else: places it on the open list with its key
+	else
+	{
+		const float kfMin = std::min(m_fG[kuiNode], m_fRhs[kuiNode]);
+		const float kfF = kfMin + heuristic(m_uiStart, kuiNode) + m_fKeyModifier;
+
+		if (m_openNodes.contains(kuiNode)) m_openNodes.update(kuiNode, kfF, kfMin);
+		else m_openNodes.push(kuiNode, kfF, kfMin);
+	}
+}
+
+// Float: Determines the straight line distance between two Nodes - Returns distance between the Nodes
+float DStarLite::heuristic(const unsigned int kuiNodeA, const unsigned int kuiNodeB) const
+{
+	return Utils::magnitude(m_pGrid->getPosition(kuiNodeA) - m_pGrid->getPosition(kuiNodeB));
+}
+
+// Float: Determines the cost of stepping between two neighbouring Nodes - Returns cost of the step, infinity if it's blocked
+float DStarLite::cost(const unsigned int kuiFrom, const unsigned int kuiTo, const CellGrid& kCells) const
+{
+	// If the Node stepped to is inaccessible, or the step cuts past one: blocked
+	if (!kCells.stepOpen(kuiFrom, kuiTo)) return std::numeric_limits<float>::infinity();
+
+	// Costs the distance between the Nodes
+	return heuristic(kuiFrom, kuiTo);
+}
\ No newline at end of file
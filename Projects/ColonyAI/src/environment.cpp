@@ -26,11 +26,26 @@ bool Environment::loadFromFile(const std::string ksFilePath)
 		sf::err() << "[FILE] Opened: " << ksFilePath << std::endl;
 	}
 
+	// Loads the file's lines
+	loadFromStream(envFile);
+
+	// Closes Environment file
+	envFile.close();
+
+	return true;
+}
+
+// Void: Loads Env data from a stream of Env file lines
+void Environment::loadFromStream(std::istream& envStream)
+{
 	// Declares a string to store file lines
 	std::string sLine;
 
+	// Entity lines, held until the Objects are read so Colonists are built with the landmark tables
+	std::vector<std::string> entityLines;
+
 	// While new lines can be gotten
-	while (std::getline(envFile, sLine)) // Gets next line
+	while (std::getline(envStream, sLine)) // Gets next line
 	{
 		// Creates a string stream with the line
 		std::istringstream iss(sLine);
@@ -55,50 +70,326 @@ bool Environment::loadFromFile(const std::string ksFilePath)
 		// If prefix is Entity:
 		else if (sPrefix == "Entity:")
 		{
-			readEntityLine(iss); // Reads the entity line
+			entityLines.push_back(sLine); // Holds the entity line until the Objects are read
 		}
 
 		// Else the prefix isn't recognised
 		else {}
 	}
 
-	// Closes Environment file
-	envFile.close();
+	// If the Environment has a grid
+	if (m_pNavGrid != nullptr)
+	{
+		// Marks the Nodes every Object makes inaccessible, as a Colonist learning them all would, building each footprint
+		m_staticCells = CellGrid(m_pNavGrid->getCols(), m_pNavGrid->getRows());
+		for (std::shared_ptr<Object> pObject : m_pObjects)
+		{
+			for (unsigned int uiIndex : getFootprint(pObject))
+			{
+				if (m_staticCells.block(uiIndex)) m_ullStaticKnowledge ^= m_pNavGrid->getKey(uiIndex);
+			}
+		}
 
-	return true;
+		// Builds the landmark tables against them
+		m_pLandmarks = std::shared_ptr<Landmarks>(new Landmarks(m_pNavGrid, m_staticCells, m_kuiLandmarkCount));
+	}
+
+	// For all entity lines held: reads them now the tables every Pathfinding takes on creation exist
+	for (const std::string& ksEntityLine : entityLines)
+	{
+		// Skips the prefix, it's known to be Entity:
+		std::istringstream iss(ksEntityLine);
+		std::string sPrefix = "";
+		iss >> sPrefix;
+
+		readEntityLine(iss); // Reads the entity line
+	}
 }
 
 // Void: Called to update the environment
 void Environment::update(const float kfElapsedTime)
 {
-	// For every Object in the Environment
-	for (std::shared_ptr<Object> pObject : m_pObjects)
+	// Refills the expansion budget shared by time-sliced searches
+	m_uiExpansionsLeft = m_kuiExpansionBudget;
+
+	// Time the Colonists' Memories are stamped with, the same for every Colonist this update
+	const long klTime = (long)time(NULL);
+
+	// For every Bush in the Environment
+	for (const std::shared_ptr<Bush>& kpBush : m_pBushes)
 	{
-		// If Object is a Bush
-		if (pObject->getType() == BUSH)
-		{
-			// Casts the Object to a Bush
-			std::shared_ptr<Bush> pBush = std::dynamic_pointer_cast<Bush>(pObject);
+		// Updates the Bush
+		kpBush->update(kfElapsedTime);
+	}
 
-			// Updates the Bush
-			pBush->update(kfElapsedTime);
+	// Colonists and Bushes add Entities as they update, which moves the vectors, so they're looped by index
+	// Entities added this update are updated this update too
+
+	// Colonists born during the update are updated after the rest, so the Colonists are updated in waves
+	unsigned int uiFirst = 0;
+	while (uiFirst < m_pColonists.size())
+	{
+		// Colonists in this wave
+		const unsigned int kuiEnd = (unsigned int)m_pColonists.size();
+
+		// Grows the needs of the wave, a Colonist's slot is its index as it's given on being added
+		m_pColonistComponents->updateNeeds(uiFirst, kuiEnd, kfElapsedTime);
+
+		// Phase one: the wave decides in parallel, each Colonist only changing itself, its state, path and the Nodes it learns are inaccessible
+		decideColonists(uiFirst, kuiEnd, klTime);
+
+		// Phase two: for every Colonist in the wave in order, committing births, Memory sharing and path requests
+		for (unsigned int i = uiFirst; i < kuiEnd; i++)
+		{
+			// Updates the Colonist
+			m_pColonists[i]->update(kfElapsedTime);
 		}
+
+		// Moves the wave along their paths
+		m_pColonistComponents->updateMovement(uiFirst, kuiEnd, kfElapsedTime);
+
+		// For every Colonist in the wave in order: moves it between spatial hash buckets and refines its path past a waypoint reached
+		for (unsigned int i = uiFirst; i < kuiEnd; i++) m_pColonists[i]->commitMovement();
+
+		uiFirst = kuiEnd;
 	}
 
-	// For every Entity in the Environment
-	// WHY THIS CRASHES THE PROGRAM I DON'T KNOW
-	//for (std::shared_ptr<Entity> pEntity : m_pEntities)
-	//{
-	//	// Updates the Entity
-	//	pEntity->update(kfElapsedTime);
-	//}
+	// For every Food in the Environment
+	for (unsigned int i = 0; i < m_pFoods.size(); i++)
+	{
+		// Updates the Food
+		m_pFoods[i]->update(kfElapsedTime);
+	}
+}
 
-	// For every Entity in the Environment
-	for (unsigned int i = 0; i < m_pEntities.size(); i++)
+// Void: Has a range of Colonists perceive and decide, spread over the worker threads
+void Environment::decideColonists(const unsigned int kuiFirst, const unsigned int kuiEnd, const long klTime)
+{
+	// Every Colonist in the range takes in what it can see
+	runColonists(kuiFirst, kuiEnd, [this, kuiFirst, klTime](const unsigned int kuiIndex) { m_pColonists[kuiFirst + kuiIndex]->perceive(klTime); });
+
+	// Adds what they perceived to the Memories in order, as adding can move every Colonist's Memories
+	for (unsigned int i = kuiFirst; i < kuiEnd; i++) m_pColonists[i]->commitMemories();
+
+	// Every Colonist in the range decides
+	runColonists(kuiFirst, kuiEnd, [this, kuiFirst](const unsigned int kuiIndex) { m_pColonists[kuiFirst + kuiIndex]->decide(); });
+}
+
+// Void: Runs a task for a range of Colonists, spread over the worker threads
+void Environment::runColonists(const unsigned int kuiFirst, const unsigned int kuiEnd, const std::function<void(const unsigned int)>& kTask)
+{
+	// If there are worker threads and enough Colonists to be worth waking them: shares the Colonists between them
+	if ((m_pWorkerPool != nullptr) && (kuiEnd - kuiFirst >= m_kuiMinSharedWave))
+	{
+		m_pWorkerPool->run(kuiEnd - kuiFirst, kTask);
+	}
+
+	// Else the task runs for every Colonist on this thread
+	else
+	{
+		for (unsigned int i = 0; i < kuiEnd - kuiFirst; i++) kTask(i);
+	}
+}
+
+// Void: Sets the number of threads the Environment updates with, shared between path requests and deciding
+void Environment::setUpdateThreads(const unsigned int kuiThreads)
+{
+	// Threads beside the update thread, so the pools never hold more threads than there are cores
+	const unsigned int kuiSpare = (kuiThreads > 1) ? kuiThreads - 1 : 0;
+
+	// Path request workers take half the spare threads, rounded up, as they search through every phase of the update
+	const unsigned int kuiPathWorkers = (kuiSpare + 1) / 2;
+
+	// The deciding workers take the rest, joined by the update thread while deciding
+	const unsigned int kuiDecideWorkers = kuiSpare - kuiPathWorkers;
+
+	// If there's a thread for them: starts the path request workers, else searches are time-sliced on the update thread
+	if (kuiPathWorkers > 0) m_pPathService = std::shared_ptr<PathService>(new PathService(kuiPathWorkers));
+	else m_pPathService = nullptr;
+
+	// If there's a thread for them: starts the deciding workers, else the Colonists decide on the update thread
+	if (kuiDecideWorkers > 0) m_pWorkerPool = std::shared_ptr<WorkerPool>(new WorkerPool(kuiDecideWorkers));
+	else m_pWorkerPool = nullptr;
+}
+
+// Void: Adds an Object to the Environment, after it's been added to its typed store
+void Environment::storeObject(std::shared_ptr<Object> pObject, const unsigned int kuiStoreIndex)
+{
+	// Stores the Object and where to find it in its typed store
+	m_pObjects.push_back(pObject);
+	m_objectHandles.push_back({ pObject->getType(), kuiStoreIndex });
+
+	// If the Object is a Food or Water source: counts it towards the home position
+	if ((pObject->getType() == BUSH) || (pObject->getType() == WATER))
 	{
-		// Updates the Entity
-		m_pEntities.at(i)->update(kfElapsedTime);
+		m_sourceSum += pObject->getPosition();
+		m_uiSourceCount++;
 	}
+
+	// If the spatial hash exists: adds the Object to its bucket
+	if (m_pObjectHash != nullptr) m_pObjectHash->insert((unsigned int)m_pObjects.size() - 1, pObject->getPosition(), pObject->getRadius());
+
+	// If the grid exists: builds the footprint now, so Colonists deciding in parallel only ever read the footprints
+	if (m_pNavGrid != nullptr) getFootprint(pObject);
+}
+
+// Void: Adds a Bush to the Environment
+void Environment::addObject(std::shared_ptr<Bush> pObject)
+{
+	m_pBushes.push_back(pObject);
+	storeObject(pObject, (unsigned int)m_pBushes.size() - 1);
+}
+
+// Void: Adds a Rock to the Environment
+void Environment::addObject(std::shared_ptr<Rock> pObject)
+{
+	m_pRocks.push_back(pObject);
+	storeObject(pObject, (unsigned int)m_pRocks.size() - 1);
+}
+
+// Void: Adds a Tree to the Environment
+void Environment::addObject(std::shared_ptr<Tree> pObject)
+{
+	m_pTrees.push_back(pObject);
+	storeObject(pObject, (unsigned int)m_pTrees.size() - 1);
+}
+
+// Void: Adds a Water to the Environment
+void Environment::addObject(std::shared_ptr<Water> pObject)
+{
+	m_pWaters.push_back(pObject);
+	storeObject(pObject, (unsigned int)m_pWaters.size() - 1);
+}
+
+// Void: Adds an Entity to the Environment, after it's been added to its typed store
+void Environment::storeEntity(std::shared_ptr<Entity> pEntity)
+{
+	// Index the Entity will have
+	const unsigned int kuiIndex = (unsigned int)m_pEntities.size();
+
+	// Stores the Entity and its index
+	m_pEntities.push_back(pEntity);
+	m_entityIndices[pEntity.get()] = kuiIndex;
+
+	// If the spatial hash exists: adds the Entity to its bucket
+	if (m_pEntityHash != nullptr) m_pEntityHash->insert(kuiIndex, pEntity->getPosition(), pEntity->getRadius());
+}
+
+// Void: Adds a Colonist to the Environment
+void Environment::addEntity(std::shared_ptr<Colonist> pEntity)
+{
+	m_pColonists.push_back(pEntity);
+
+	// Where the store's positions are, which moves if the new Colonist's doesn't fit
+	const sf::Vector2f* kpPositions = m_pColonistComponents->getPositionData();
+
+	// Moves the Colonist's components into the store, so its slot there is its index, which the systems rely on
+	pEntity->setComponentStore(m_pColonistComponents);
+
+	// If the positions moved: points every Colonist at its position again
+	if (m_pColonistComponents->getPositionData() != kpPositions)
+	{
+		for (const std::shared_ptr<Colonist>& kpColonist : m_pColonists) kpColonist->bindPosition();
+	}
+
+	storeEntity(pEntity);
+}
+
+// Void: Adds a Food to the Environment
+void Environment::addEntity(std::shared_ptr<Food> pEntity)
+{
+	m_pFoods.push_back(pEntity);
+	storeEntity(pEntity);
+}
+
+// Void: Moves an Entity to the spatial hash bucket of its current position
+void Environment::moveEntity(const Entity* kpEntity, const sf::Vector2f kFrom)
+{
+	// If there is no spatial hash: nothing to update
+	if (m_pEntityHash == nullptr) return;
+
+	// Looks up the Entity's index
+	std::map<const Entity*, unsigned int>::iterator it = m_entityIndices.find(kpEntity);
+
+	// If the Entity is in the Environment: moves it between buckets
+	if (it != m_entityIndices.end()) m_pEntityHash->move(it->second, kFrom, m_pEntities[it->second]->getPosition());
+}
+
+// IndexedView<Object>: Returns the Objects that may reach within a radius of a point - Returns view of the Objects
+IndexedView<Object> Environment::getObjectsNear(const sf::Vector2f kPosition, const float kfRadius, std::vector<unsigned int>& indices)
+{
+	// If there is a spatial hash: finds the indices of the Objects near
+	if (m_pObjectHash != nullptr) m_pObjectHash->query(kPosition, kfRadius, indices);
+
+	// Else every Object may be near
+	else
+	{
+		indices.clear();
+		for (unsigned int i = 0; i < m_pObjects.size(); i++) indices.push_back(i);
+	}
+
+	return IndexedView<Object>(m_pObjects, indices);
+}
+
+// Void: Finds the Objects of a certain type that may reach within a radius of a point
+void Environment::findObjectsNear(const sf::Vector2f kPosition, const float kfRadius, const ObjectType kType, std::vector<unsigned int>& indices)
+{
+	// Finds the Objects near
+	getObjectsNear(kPosition, kfRadius, indices);
+
+	// Keeps those of the type, swapping each for its index in the typed store
+	// The typed stores are filled in the same order as m_pObjects, so the order is kept
+	unsigned int uiKept = 0;
+	for (const unsigned int kuiIndex : indices)
+	{
+		const ObjectHandle& kHandle = m_objectHandles[kuiIndex];
+		if (kHandle.m_type == kType) indices[uiKept++] = kHandle.m_uiIndex;
+	}
+	indices.resize(uiKept);
+}
+
+// IndexedView<Bush>: Returns the Bushes that may reach within a radius of a point - Returns view of the Bushes
+IndexedView<Bush> Environment::getBushesNear(const sf::Vector2f kPosition, const float kfRadius, std::vector<unsigned int>& indices)
+{
+	findObjectsNear(kPosition, kfRadius, BUSH, indices);
+
+	return IndexedView<Bush>(m_pBushes, indices);
+}
+
+// IndexedView<Water>: Returns the Water Objects that may reach within a radius of a point - Returns view of the Water Objects
+IndexedView<Water> Environment::getWatersNear(const sf::Vector2f kPosition, const float kfRadius, std::vector<unsigned int>& indices)
+{
+	findObjectsNear(kPosition, kfRadius, WATER, indices);
+
+	return IndexedView<Water>(m_pWaters, indices);
+}
+
+// IndexedView<Entity>: Returns the Entities that may reach within a radius of a point - Returns view of the Entities
+IndexedView<Entity> Environment::getEntitiesNear(const sf::Vector2f kPosition, const float kfRadius, std::vector<unsigned int>& indices)
+{
+	// If there is a spatial hash: finds the indices of the Entities near
+	if (m_pEntityHash != nullptr) m_pEntityHash->query(kPosition, kfRadius, indices);
+
+	// Else every Entity may be near
+	else
+	{
+		indices.clear();
+		for (unsigned int i = 0; i < m_pEntities.size(); i++) indices.push_back(i);
+	}
+
+	return IndexedView<Entity>(m_pEntities, indices);
+}
+
+// const std::vector<unsigned int>&: Returns the Nodes a Colonist can't stand on because of an Object - Returns indices of the Nodes in ascending order
+const std::vector<unsigned int>& Environment::getFootprint(const std::shared_ptr<Object> kpObject)
+{
+	// Looks up the footprint
+	std::map<const Object*, std::vector<unsigned int>>::iterator it = m_footprints.find(kpObject.get());
+
+	// If there isn't one yet: works it out
+	if (it == m_footprints.end()) it = m_footprints.insert(std::make_pair(kpObject.get(), m_pNavGrid->footprint(kpObject->getPosition(), kpObject->getRadius(), m_kfColonistRadius))).first;
+
+	return it->second;
 }
 
 // Void: Called to draw the environment
@@ -165,12 +456,45 @@ void Environment::readEnvLine(std::istringstream& iss)
 			// uiY is set by converting the word string to an int
 			uiY = std::stoi(word.substr(1, word.size() - 1));
 		}
+		// If word begins with 'n'
+		else if (word.front() == 'n')
+		{
+			// fNodeDiameter is set by converting the word string to a float
+			const float kfNodeDiameter = std::stof(word.substr(1, word.size() - 1));
+
+			// If the diameter is usable: replaces the default
+			if (kfNodeDiameter > 0.0f) m_fNodeDiameter = kfNodeDiameter;
+			else sf::err() << "[FILE] Invalid Node diameter: " << kfNodeDiameter << ", using " << m_fNodeDiameter << std::endl;
+		}
 	}
 
-	sf::err() << "[FILE] Environment read: x(" << uiX << ") y(" << uiY << ")" << std::endl;
+	sf::err() << "[FILE] Environment read: x(" << uiX << ") y(" << uiY << ") n(" << m_fNodeDiameter << ")" << std::endl;
 
 	// Sets member to derived size
 	m_size = sf::Vector2u(uiX, uiY);
+
+	// Generates the grid of Nodes covering the Environment
+	m_pNavGrid = std::shared_ptr<NavGrid>(new NavGrid(m_size, m_fNodeDiameter));
+
+	// Creates the flow field cache for the grid
+	m_pFlowFields = std::shared_ptr<FlowFieldCache>(new FlowFieldCache());
+
+	// Creates the path cache for the grid
+	m_pPathCache = std::shared_ptr<PathCache>(new PathCache(512));
+
+	// Creates the pools of replanners and time-sliced search buffers for the grid
+	std::shared_ptr<NavGrid> pGrid = m_pNavGrid;
+	m_pReplanners = std::shared_ptr<BufferPool<DStarLite>>(new BufferPool<DStarLite>([pGrid]() { return new DStarLite(pGrid); }));
+	m_pSliceBuffers = std::shared_ptr<BufferPool<SearchBuffer>>(new BufferPool<SearchBuffer>([]() { return new SearchBuffer(); }));
+
+	// Creates the spatial hashes, adding anything read before the size
+	m_pObjectHash = std::shared_ptr<SpatialHash>(new SpatialHash(m_size, m_kfBucketSize));
+	m_pEntityHash = std::shared_ptr<SpatialHash>(new SpatialHash(m_size, m_kfBucketSize));
+	for (unsigned int i = 0; i < m_pObjects.size(); i++) m_pObjectHash->insert(i, m_pObjects[i]->getPosition(), m_pObjects[i]->getRadius());
+	for (unsigned int i = 0; i < m_pEntities.size(); i++) m_pEntityHash->insert(i, m_pEntities[i]->getPosition(), m_pEntities[i]->getRadius());
+
+	// Shares every core between the update thread, the path request workers and the deciding workers
+	setUpdateThreads(std::thread::hardware_concurrency());
 }
 
 // Void: Reads an Object file line
@@ -223,14 +547,14 @@ void Environment::readObjectLine(std::istringstream& iss)
 
 	sf::err() << "[FILE] Object read: type(" << Object::typeToStr(type) << ") x(" << fX << ") y(" << fY << ") r(" << fR << ")" << std::endl;
 
-	// Creates a shared_ptr from this object
-	std::shared_ptr<Environment> pThisEnv = std::shared_ptr<Environment>(this);
+	// Creates a non-owning shared_ptr from this object, the Environment outlives its contents
+	std::shared_ptr<Environment> pThisEnv = std::shared_ptr<Environment>(this, [](Environment*) {});
 
 	// With objectType creates a new Object subclass and stores a reference in the m_pObjects member
-	if (type == BUSH) m_pObjects.push_back(std::shared_ptr<Object>(new Bush(pThisEnv, sf::Vector2f(fX, fY), fR)));
-	else if (type == ROCK) m_pObjects.push_back(std::shared_ptr<Object>(new Rock(pThisEnv, sf::Vector2f(fX, fY), fR)));
-	else if (type == TREE) m_pObjects.push_back(std::shared_ptr<Object>(new Tree(pThisEnv, sf::Vector2f(fX, fY), fR)));
-	else if (type == WATER) m_pObjects.push_back(std::shared_ptr<Object>(new Water(pThisEnv, sf::Vector2f(fX, fY), fR)));
+	if (type == BUSH) addObject(std::shared_ptr<Bush>(new Bush(pThisEnv, sf::Vector2f(fX, fY), fR)));
+	else if (type == ROCK) addObject(std::shared_ptr<Rock>(new Rock(pThisEnv, sf::Vector2f(fX, fY), fR)));
+	else if (type == TREE) addObject(std::shared_ptr<Tree>(new Tree(pThisEnv, sf::Vector2f(fX, fY), fR)));
+	else if (type == WATER) addObject(std::shared_ptr<Water>(new Water(pThisEnv, sf::Vector2f(fX, fY), fR)));
 }
 
 // Void: Reads an Entity file line
@@ -277,10 +601,10 @@ void Environment::readEntityLine(std::istringstream& iss)
 
 	sf::err() << "[FILE] Entity read: type(" << Entity::typeToStr(type) << ") x(" << fX << ") y(" << fY << ") h(" << fH << ")" << std::endl;
 
-	// Creates a shared_ptr from this object
-	std::shared_ptr<Environment> pThisEnv = std::shared_ptr<Environment>(this);
+	// Creates a non-owning shared_ptr from this object, the Environment outlives its contents
+	std::shared_ptr<Environment> pThisEnv = std::shared_ptr<Environment>(this, [](Environment*) {});
 
 	// With entityType creates a new Entity subclass and stores a reference in the m_pEntities member
-	if (type == COLONIST) m_pEntities.push_back( std::shared_ptr<Entity>(new Colonist(pThisEnv, sf::Vector2f(fX, fY), fH)));
-	else if (type == FOOD) m_pEntities.push_back(std::shared_ptr<Entity>(new Food(pThisEnv, sf::Vector2f(fX, fY))));
+	if (type == COLONIST) addEntity(std::shared_ptr<Colonist>(new Colonist(pThisEnv, sf::Vector2f(fX, fY), fH)));
+	else if (type == FOOD) addEntity(std::shared_ptr<Food>(new Food(pThisEnv, sf::Vector2f(fX, fY))));
 }
\ No newline at end of file
@@ -0,0 +1,207 @@
+/**
+@file flowfield.cpp
+*/
+
+// Imports
+#include "flowfield.h"
+
+// Constructor
+FlowField::FlowField(std::shared_ptr<NavGrid> pGrid, const sf::Vector2f kTargetPos, const float kfTargetRadius)
+{
+	// Sets member values to corresponding input
+	m_pGrid = pGrid;
+	m_targetPos = kTargetPos;
+	m_fTargetRadius = kfTargetRadius;
+	m_ullKnowledge = 0;
+}
+
+// Void: Computes the whole field from a set of seed Nodes
+void FlowField::integrate(const std::vector<unsigned int>& kSeeds, const CellGrid& kCells, const unsigned long long kullKnowledge)
+{
+	// Sets member values to corresponding input
+	m_uiSeeds = kSeeds;
+	m_cells = kCells;
+	m_ullKnowledge = kullKnowledge;
+
+	// Every Node starts unreached
+	m_fCosts.assign(m_pGrid->getNodeCount(), std::numeric_limits<float>::infinity());
+	m_uiNext.assign(m_pGrid->getNodeCount(), g_kuiNoNode);
+
+	// Queue of Nodes to spread from, cheapest first
+	std::priority_queue<std::pair<float, unsigned int>, std::vector<std::pair<float, unsigned int>>, std::greater<std::pair<float, unsigned int>>> openNodes;
+
+	// For all seeds: costs nothing to reach the target from
+	for (unsigned int uiSeed : m_uiSeeds)
+	{
+		m_fCosts[uiSeed] = 0.0f;
+		openNodes.push(std::make_pair(0.0f, uiSeed));
+	}
+
+	// Spreads the costs over the grid
+	spread(openNodes);
+}
+
+// Void: Repairs the field for Nodes that have become inaccessible since it was computed
+void FlowField::repair(const CellGrid& kCells, const unsigned long long kullKnowledge)
+{
+	// Declares states for the Nodes: unchecked, leads to a seed, or leads through a newly inaccessible Node
+	enum RouteState { UNCHECKED, INTACT, BROKEN };
+	std::vector<unsigned char> states(m_pGrid->getNodeCount(), UNCHECKED);
+
+	// Takes the new accessibility, keeping the old to compare with
+	CellGrid previous = kCells;
+	std::swap(previous, m_cells);
+	m_ullKnowledge = kullKnowledge;
+
+	// For all Nodes
+	for (unsigned int uiIndex = 0; uiIndex < m_pGrid->getNodeCount(); uiIndex++)
+	{
+		// If the Node has become inaccessible: it no longer leads anywhere
+		if (m_cells.isBlocked(uiIndex) && !previous.isBlocked(uiIndex)) states[uiIndex] = BROKEN;
+		// Else If the Node is a seed or unreached: its route can't break
+		else if (m_uiNext[uiIndex] == g_kuiNoNode) states[uiIndex] = INTACT;
+		// Else If the step to its next Node has closed: its route is broken
+		else if (!m_cells.stepOpen(uiIndex, m_uiNext[uiIndex])) states[uiIndex] = BROKEN;
+	}
+
+	// Vector of Nodes along the route being followed
+	std::vector<unsigned int> route;
+
+	// For all Nodes
+	for (unsigned int uiIndex = 0; uiIndex < m_pGrid->getNodeCount(); uiIndex++)
+	{
+		// Follows the route until a Node with a known state
+		unsigned int uiNode = uiIndex;
+		while (states[uiNode] == UNCHECKED)
+		{
+			route.push_back(uiNode);
+			uiNode = m_uiNext[uiNode];
+		}
+
+		// Every Node along the route shares that state
+		for (unsigned int uiRouteNode : route) states[uiRouteNode] = states[uiNode];
+		route.clear();
+	}
+
+	// Queue of Nodes to spread from, cheapest first
+	std::priority_queue<std::pair<float, unsigned int>, std::vector<std::pair<float, unsigned int>>, std::greater<std::pair<float, unsigned int>>> openNodes;
+
+	// For all Nodes with a broken route: resets them
+	for (unsigned int uiIndex = 0; uiIndex < m_pGrid->getNodeCount(); uiIndex++)
+	{
+		if (states[uiIndex] == BROKEN)
+		{
+			m_fCosts[uiIndex] = std::numeric_limits<float>::infinity();
+			m_uiNext[uiIndex] = g_kuiNoNode;
+		}
+	}
+
+	// For all Nodes with a broken route
+	for (unsigned int uiIndex = 0; uiIndex < m_pGrid->getNodeCount(); uiIndex++)
+	{
+		// If the Node's route is intact or it can't be walked on: skip it
+		if ((states[uiIndex] != BROKEN) || m_cells.isBlocked(uiIndex)) continue;
+
+		// For all neighbours, diagonals only past accessible Nodes
+		for (unsigned int uiAdj : m_cells.adjacentNodes<8>(uiIndex, true))
+		{
+			// If the neighbour kept its route and can be stepped to: routes through it if cheaper
+			if ((states[uiAdj] == INTACT) && (m_fCosts[uiAdj] < std::numeric_limits<float>::infinity()) && !m_cells.isBlocked(uiAdj))
+			{
+				float fCost = m_fCosts[uiAdj] + Utils::magnitude(m_pGrid->getPosition(uiAdj) - m_pGrid->getPosition(uiIndex));
+				if (fCost < m_fCosts[uiIndex])
+				{
+					m_fCosts[uiIndex] = fCost;
+					m_uiNext[uiIndex] = uiAdj;
+				}
+			}
+		}
+
+		// If the Node was reached from an intact neighbour: spreads from it
+		if (m_uiNext[uiIndex] != g_kuiNoNode) openNodes.push(std::make_pair(m_fCosts[uiIndex], uiIndex));
+	}
+
+	// Spreads the costs over the reset Nodes
+	spread(openNodes);
+}
+
+// Bool: Returns whether the field can be repaired to match a set of inaccessible Nodes - Returns whether every Node inaccessible to the field is still inaccessible
+bool FlowField::canRepairTo(const CellGrid& kCells) const
+{
+	// Can repair if every Node inaccessible to the field is still inaccessible, costs could only fall otherwise
+	return kCells.covers(m_cells);
+}
+
+// Void: Spreads cheaper costs outward from queued Nodes
+void FlowField::spread(std::priority_queue<std::pair<float, unsigned int>, std::vector<std::pair<float, unsigned int>>, std::greater<std::pair<float, unsigned int>>>& openNodes)
+{
+	// While there are Nodes to spread from
+	while (!openNodes.empty())
+	{
+		// Takes the cheapest Node
+		const float kfCost = openNodes.top().first;
+		const unsigned int kuiNode = openNodes.top().second;
+		openNodes.pop();
+
+		// If a cheaper cost has since been found: this entry is stale
+		if (kfCost > m_fCosts[kuiNode]) continue;
+
+		// For all neighbours, diagonals only past accessible Nodes
+		for (unsigned int uiAdj : m_cells.adjacentNodes<8>(kuiNode, true))
+		{
+			// If the neighbour can't be walked on: skip it
+			if (m_cells.isBlocked(uiAdj)) continue;
+
+			// Cost to the target from the neighbour through this Node
+			float fCost = kfCost + Utils::magnitude(m_pGrid->getPosition(uiAdj) - m_pGrid->getPosition(kuiNode));
+
+			// If cheaper than the neighbour's cost: the neighbour steps to this Node
+			if (fCost < m_fCosts[uiAdj])
+			{
+				m_fCosts[uiAdj] = fCost;
+				m_uiNext[uiAdj] = kuiNode;
+				openNodes.push(std::make_pair(fCost, uiAdj));
+			}
+		}
+	}
+}
+
+// std::shared_ptr<FlowField>: Finds a field for a target computed with the given knowledge - Returns the field, nullptr if there is none
+std::shared_ptr<FlowField> FlowFieldCache::find(const sf::Vector2f kTargetPos, const float kfTargetRadius, const unsigned long long kullKnowledge)
+{
+	// Key of the field
+	FieldKey key = { kTargetPos.x, kTargetPos.y, kfTargetRadius, kullKnowledge };
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	// Looks up the field
+	std::map<FieldKey, std::weak_ptr<FlowField>>::iterator it = m_pFields.find(key);
+
+	// If there is no field: return nullptr
+	if (it == m_pFields.end()) return nullptr;
+
+	// Takes a hold of the field
+	std::shared_ptr<FlowField> pField = it->second.lock();
+
+	// If no Pathfinding holds the field any more: forgets it
+	if (pField == nullptr) m_pFields.erase(it);
+
+	return pField;
+}
+
+// Void: Adds a field so other Pathfinding can share it
+void FlowFieldCache::insert(const std::shared_ptr<FlowField> kpField)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	// For all fields: forgets the ones no Pathfinding holds
+	for (std::map<FieldKey, std::weak_ptr<FlowField>>::iterator it = m_pFields.begin(); it != m_pFields.end();)
+	{
+		if (it->second.expired()) it = m_pFields.erase(it);
+		else it++;
+	}
+
+	// Adds the field under its target and knowledge
+	FieldKey key = { kpField->getTargetPos().x, kpField->getTargetPos().y, kpField->getTargetRadius(), kpField->getKnowledge() };
+	m_pFields[key] = kpField;
+}
\ No newline at end of file
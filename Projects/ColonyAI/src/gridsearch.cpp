@@ -0,0 +1,108 @@
+/**
+@file gridsearch.cpp
+*/
+
+// Imports
+#include "gridsearch.h"
+
+// Constructor
+GridSearch::GridSearch(const NavGrid& kGrid, const CellGrid& kCells, const Heuristic kHeuristic, const Landmarks* kpLandmarks, std::ostream& log) : m_kGrid(kGrid), m_kCells(kCells), m_log(log)
+{
+	// Sets member values to corresponding input
+	m_heuristic = kHeuristic;
+	m_kpLandmarks = kpLandmarks;
+}
+
+// Bool: Determines whether the Node at a column and row can be walked on - Returns whether the Node is walkable
+bool GridSearch::walkable(const int kiX, const int kiY, const bool kbIgnoreAccess) const
+{
+	// If respecting accessibility: walkable if on the grid and accessible
+	if (!kbIgnoreAccess) return m_kCells.walkable(kiX, kiY);
+
+	// Else: walkable if on the grid
+	return (kiX >= 0) && (kiY >= 0) && (kiX < (int)m_kGrid.getCols()) && (kiY < (int)m_kGrid.getRows());
+}
+
+// Float: Calculates G value of a Node - Returns the calculated G value
+float GridSearch::calcG(const SearchBuffer& kBuffer, const unsigned int kuiCurrentNode, const unsigned int kuiTargetNode) const
+{
+	// Distance from the current Node and open Node
+	float fDistToNode = Utils::magnitude(m_kGrid.getPosition(kuiTargetNode) - m_kGrid.getPosition(kuiCurrentNode));
+
+	// Returns resultant G value (distance to next Node plus current Node's G)
+	return fDistToNode + kBuffer.m_fG[kuiCurrentNode];
+}
+
+// Float: Detemines the distance from one Node to another with the manhattan algorithm - Returns distance to the end Node
+float GridSearch::distance(const unsigned int kuiStartNode, const unsigned int kuiEndNode) const
+{
+	// Number of Nodes needed horizontally to match destination
+	float fXDist = (m_kGrid.getPosition(kuiEndNode).x - m_kGrid.getPosition(kuiStartNode).x) / m_kGrid.getNodeDiameter();
+
+	// Number of Nodes needed vertically to match destination
+	float fYDist = (m_kGrid.getPosition(kuiEndNode).y - m_kGrid.getPosition(kuiStartNode).y) / m_kGrid.getNodeDiameter();
+
+	// Combines the distances in the x and y axis
+	float fDistance = abs(fXDist) + abs(fYDist);
+
+	// Returns the combined distances, bound to positive
+	return fDistance;
+}
+
+// Float: Determines the length of the shortest 8-way route from one Node to another, ignoring accessibility - Returns distance to the end Node
+float GridSearch::octile(const unsigned int kuiStartNode, const unsigned int kuiEndNode) const
+{
+	// Distance to cover in each axis
+	const float kfXDist = fabs(m_kGrid.getPosition(kuiEndNode).x - m_kGrid.getPosition(kuiStartNode).x);
+	const float kfYDist = fabs(m_kGrid.getPosition(kuiEndNode).y - m_kGrid.getPosition(kuiStartNode).y);
+
+	// Diagonal steps cover the shorter axis, straight steps the rest
+	return (Utils::max(kfXDist, kfYDist) - Utils::min(kfXDist, kfYDist)) + (Utils::min(kfXDist, kfYDist) * sqrtf(2.0f));
+}
+
+// Float: Estimates the distance left from a Node to the target with the selected heuristic - Returns estimated distance to the target
+float GridSearch::heuristic(const unsigned int kuiNode, const unsigned int kuiTarget, const bool kbIgnoreAccess) const
+{
+	// If using manhattan: the distance in Nodes
+	if (m_heuristic == MANHATTAN) return distance(kuiNode, kuiTarget);
+
+	// If using landmarks, respecting accessibility, and the bounds are admissible: the larger of the landmark bound and octile
+	if ((m_heuristic == ALT) && (!kbIgnoreAccess) && (m_kpLandmarks != nullptr)) return Utils::max(m_kpLandmarks->bound(kuiNode, kuiTarget), octile(kuiNode, kuiTarget));
+
+	// Else: octile
+	return octile(kuiNode, kuiTarget);
+}
+
+// std::queue<sf::Vector2f>: Creates a queue of points from a given destination back to the current position
+std::queue<sf::Vector2f> GridSearch::queuePath(const SearchBuffer& kBuffer, unsigned int uiTargetNode) const
+{
+	// Vector for stack of Node indices to be used in path
+	std::vector<unsigned int> nodes;
+
+	// Pushes destination Node onto vector
+	nodes.push_back(uiTargetNode);
+
+	// While Node has a parent
+	while (kBuffer.m_uiParents[uiTargetNode] != g_kuiNoNode)
+	{
+		// Make the Node it's Parent
+		uiTargetNode = kBuffer.m_uiParents[uiTargetNode];
+		// Push the parent onto the path of Nodes
+		nodes.push_back(uiTargetNode);
+	}
+
+	// Queue to store the output
+	std::queue<sf::Vector2f> path;
+
+	// nodes is not empty
+	while (!nodes.empty())
+	{
+		// Pushes the position of Node onto path
+		path.push(m_kGrid.getPosition(nodes.back()));
+		// Pops Node off Vector
+		nodes.pop_back();
+	}
+
+	// Returns queued path
+	return path;
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+/**
+@file hierarchicalsearch.cpp
+*/
+
+// Imports
+#include "hierarchicalsearch.h"
+
+// Constructor
+HierarchicalSearch::HierarchicalSearch(ClusterGraph& clusters, const NavGrid& kGrid, const CellGrid& kCells, std::ostream& log) : m_clusters(clusters), m_kGrid(kGrid), m_kCells(kCells), m_log(log)
+{
+}
+
+// std::queue<sf::Vector2f>: Creates a path to target Node over the cluster graph, refining only the first leg - Returns a queue of points that represent a route, empty if there is none
+std::queue<sf::Vector2f> HierarchicalSearch::search(const unsigned int kuiStart, const unsigned int kuiTarget)
+{
+	// Creates the path queue
+	std::queue<sf::Vector2f> path;
+
+	// If the cluster graph is built by this search: logs it here, as the graph may be built off the update thread
+	const bool kbBuilding = !m_clusters.isBuilt();
+	if (kbBuilding) m_log << "[PATHFINDING] Building cluster graph..." << std::endl;
+
+	// Plans the route over the entrances
+	std::vector<unsigned int> route = m_clusters.findRoute(kuiStart, kuiTarget, m_kCells);
+
+	if (kbBuilding) m_log << "[PATHFINDING] Building cluster graph... Finished." << std::endl;
+
+	// If there is no route: return empty path
+	if (route.empty())
+	{
+		m_log << "[PATHFINDING] Generating path... Error - No cluster route found, falling back to A*." << std::endl;
+		return path;
+	}
+
+	// Refines the first leg so the path starts with Nodes to walk, unless it's a single step across a border
+	std::vector<unsigned int> firstLeg(1, route.at(1));
+	if (Utils::magnitude(m_kGrid.getPosition(route.at(1)) - m_kGrid.getPosition(route.at(0))) > m_kGrid.getNodeDiameter() * 1.5f)
+	{
+		firstLeg = m_clusters.refine(route.at(0), route.at(1), m_kCells);
+	}
+
+	// If the first leg is blocked: return empty path
+	if (firstLeg.empty()) return path;
+
+	// Pushes the start and the Nodes of the first leg
+	path.push(m_kGrid.getPosition(kuiStart));
+	for (unsigned int uiNode : firstLeg) path.push(m_kGrid.getPosition(uiNode));
+
+	// Pushes the remaining waypoints, refined as they're reached
+	for (unsigned int i = 2; i < route.size(); i++) path.push(m_kGrid.getPosition(route.at(i)));
+
+	m_log << "[PATHFINDING] Generating path... Finished." << std::endl;
+	return path;
+}
\ No newline at end of file
@@ -0,0 +1,230 @@
+/**
+@file jumppointsearch.cpp
+*/
+
+// Imports
+#include "jumppointsearch.h"
+
+// Constructor
+JumpPointSearch::JumpPointSearch(const NavGrid& kGrid, const CellGrid& kCells, const Heuristic kHeuristic, const Landmarks* kpLandmarks, std::ostream& log) : GridSearch(kGrid, kCells, kHeuristic, kpLandmarks, log)
+{
+}
+
+// std::queue<sf::Vector2f>: Creates a path to target Node with Jump Point Search - Returns a queue of jump point positions that represent a route
+std::queue<sf::Vector2f> JumpPointSearch::search(SearchBuffer& buffer, unsigned int uiCurrent, const unsigned int kuiTarget, const bool kbIgnoreAccess)
+{
+	// Creates an empty path queue
+	std::queue<sf::Vector2f> nullPath;
+
+	// Index of the Node the search started at
+	const unsigned int kuiStart = uiCurrent;
+
+	// While a path has not been found
+	while (true)
+	{
+		// Counts the expansion
+		m_uiExpansions++;
+
+		// If Current Node is actually the Target Node
+		if (uiCurrent == kuiTarget)
+		{
+			// If the search started on the target there is no path to take
+			if (uiCurrent == kuiStart)
+			{
+				m_log << "[PATHFINDING] Generating path... CurrentNode equal to TargetNode." << std::endl;
+				return nullPath;
+			}
+
+			// Destination reached, create path
+			std::queue<sf::Vector2f> path(queuePath(buffer, uiCurrent));
+			m_log << "[PATHFINDING] Generating path... Finished." << std::endl;
+			return path;
+		}
+
+		// For all jump points reachable from the current Node
+		for (unsigned int uiJump : jumpSuccessors(buffer.m_uiParents[uiCurrent], uiCurrent, kuiTarget, kbIgnoreAccess))
+		{
+			// If jump point is on the closed list: ignore it
+			if (buffer.isClosed(uiJump)) continue;
+
+			// G value of the jump point through the current Node
+			float fG = calcG(buffer, uiCurrent, uiJump);
+
+			// If the jump point hasn't been reached by this search yet
+			if (!buffer.isVisited(uiJump))
+			{
+				// Resets the jump point
+				buffer.visit(uiJump);
+
+				// Sets the jump point's parent, G, H and F values
+				buffer.m_uiParents[uiJump] = uiCurrent;
+				buffer.m_fH[uiJump] = heuristic(uiJump, kuiTarget, kbIgnoreAccess);
+				buffer.m_fG[uiJump] = fG;
+				buffer.m_fF[uiJump] = fG + buffer.m_fH[uiJump];
+
+				// Adds the jump point to the open list
+				buffer.m_openNodes.push(uiJump, buffer.m_fF[uiJump], buffer.m_fH[uiJump]);
+			}
+			// Else If the route through the current Node is cheaper
+			else if (fG < buffer.m_fG[uiJump])
+			{
+				// Updates the jump point with the cheaper route
+				buffer.m_uiParents[uiJump] = uiCurrent;
+				buffer.m_fG[uiJump] = fG;
+				buffer.m_fF[uiJump] = fG + buffer.m_fH[uiJump];
+
+				// Moves the jump point up the open list
+				buffer.m_openNodes.decreaseKey(uiJump, buffer.m_fF[uiJump], buffer.m_fH[uiJump]);
+			}
+		}
+
+		// If there is an open list
+		if (!buffer.m_openNodes.empty())
+		{
+			// Pops the Node with the smallest F value (lowest H on ties) off the open list onto the closed list
+			uiCurrent = buffer.m_openNodes.pop();
+			buffer.close(uiCurrent);
+		}
+		// Else the open list is empty
+		else
+		{
+			m_log << "[PATHFINDING] Generating path... Error - No path found." << std::endl;
+			return nullPath;
+		}
+	}
+}
+
+// std::vector<unsigned int>: Generates the jump points reachable from a Node - Returns indices of the jump points
+std::vector<unsigned int> JumpPointSearch::jumpSuccessors(const unsigned int kuiParent, const unsigned int kuiNode, const unsigned int kuiTarget, const bool kbIgnoreAccess) const
+{
+	// Defines vector to store the jump points found
+	std::vector<unsigned int> jumpPoints;
+
+	// Column and row of the Node
+	const int kiX = (int)(kuiNode % m_kGrid.getCols());
+	const int kiY = (int)(kuiNode / m_kGrid.getCols());
+
+	// Declares the directions to jump in
+	std::vector<sf::Vector2i> directions;
+
+	// If the Node has no parent: every direction is searched
+	if (kuiParent == g_kuiNoNode)
+	{
+		// For all neighbours on the grid, diagonals only past walkable Nodes: searches in the direction of each
+		for (unsigned int uiAdj : m_kCells.adjacentNodes<8>(kuiNode, !kbIgnoreAccess))
+		{
+			directions.push_back(sf::Vector2i((int)(uiAdj % m_kGrid.getCols()) - kiX, (int)(uiAdj / m_kGrid.getCols()) - kiY));
+		}
+	}
+	// Else: prunes the directions with the direction travelled from the parent
+	else
+	{
+		// Direction of travel, normalised to -1, 0 or 1 in each axis
+		const int kiPX = (int)(kuiParent % m_kGrid.getCols());
+		const int kiPY = (int)(kuiParent / m_kGrid.getCols());
+		const int kiDX = (kiX > kiPX) - (kiX < kiPX);
+		const int kiDY = (kiY > kiPY) - (kiY < kiPY);
+
+		// If travelling diagonally
+		if ((kiDX != 0) && (kiDY != 0))
+		{
+			// Natural neighbours: both orthogonals and the diagonal between them
+			if (walkable(kiX, kiY + kiDY, kbIgnoreAccess)) directions.push_back(sf::Vector2i(0, kiDY));
+			if (walkable(kiX + kiDX, kiY, kbIgnoreAccess)) directions.push_back(sf::Vector2i(kiDX, 0));
+			if (walkable(kiX, kiY + kiDY, kbIgnoreAccess) && walkable(kiX + kiDX, kiY, kbIgnoreAccess)) directions.push_back(sf::Vector2i(kiDX, kiDY));
+		}
+		// Else If travelling horizontally
+		else if (kiDX != 0)
+		{
+			// Natural neighbour straight ahead
+			const bool kbAhead = walkable(kiX + kiDX, kiY, kbIgnoreAccess);
+			if (kbAhead) directions.push_back(sf::Vector2i(kiDX, 0));
+
+			// For either side
+			for (int iSide = -1; iSide <= 1; iSide += 2)
+			{
+				// If the side is open and blocked behind: forced neighbour beside, with the diagonal ahead of it if the way ahead is open
+				if (walkable(kiX, kiY + iSide, kbIgnoreAccess) && !walkable(kiX - kiDX, kiY + iSide, kbIgnoreAccess))
+				{
+					directions.push_back(sf::Vector2i(0, iSide));
+					if (kbAhead) directions.push_back(sf::Vector2i(kiDX, iSide));
+				}
+			}
+		}
+		// Else travelling vertically
+		else
+		{
+			// Natural neighbour straight ahead
+			const bool kbAhead = walkable(kiX, kiY + kiDY, kbIgnoreAccess);
+			if (kbAhead) directions.push_back(sf::Vector2i(0, kiDY));
+
+			// For either side
+			for (int iSide = -1; iSide <= 1; iSide += 2)
+			{
+				// If the side is open and blocked behind: forced neighbour beside, with the diagonal ahead of it if the way ahead is open
+				if (walkable(kiX + iSide, kiY, kbIgnoreAccess) && !walkable(kiX + iSide, kiY - kiDY, kbIgnoreAccess))
+				{
+					directions.push_back(sf::Vector2i(iSide, 0));
+					if (kbAhead) directions.push_back(sf::Vector2i(iSide, kiDY));
+				}
+			}
+		}
+	}
+
+	// For all directions to search
+	for (const sf::Vector2i& kDirection : directions)
+	{
+		// Jumps from the neighbour in that direction
+		unsigned int uiJump = jump(kiX + kDirection.x, kiY + kDirection.y, kDirection.x, kDirection.y, kuiTarget, kbIgnoreAccess);
+
+		// If a jump point was found: adds it
+		if (uiJump != g_kuiNoNode) jumpPoints.push_back(uiJump);
+	}
+
+	return jumpPoints;
+}
+
+// Unsigned Int: Travels from a Node in a direction until a jump point is found - Returns index of the jump point, g_kuiNoNode if there is none
+unsigned int JumpPointSearch::jump(int iX, int iY, const int kiDX, const int kiDY, const unsigned int kuiTarget, const bool kbIgnoreAccess) const
+{
+	// While travelling in the direction
+	while (true)
+	{
+		// If the Node can't be walked on: no jump point this way
+		if (!walkable(iX, iY, kbIgnoreAccess)) return g_kuiNoNode;
+
+		// Index of the Node
+		unsigned int uiIndex = (unsigned int)iX + (m_kGrid.getCols() * (unsigned int)iY);
+
+		// If the Node is the target: it's a jump point
+		if (uiIndex == kuiTarget) return uiIndex;
+
+		// If travelling diagonally
+		if ((kiDX != 0) && (kiDY != 0))
+		{
+			// If a jump point lies horizontally or vertically from here: this Node is a jump point
+			if ((jump(iX + kiDX, iY, kiDX, 0, kuiTarget, kbIgnoreAccess) != g_kuiNoNode) || (jump(iX, iY + kiDY, 0, kiDY, kuiTarget, kbIgnoreAccess) != g_kuiNoNode)) return uiIndex;
+		}
+		// Else If travelling horizontally
+		else if (kiDX != 0)
+		{
+			// If an obstacle behind opens up beside the Node: it has a forced neighbour
+			if ((walkable(iX, iY - 1, kbIgnoreAccess) && !walkable(iX - kiDX, iY - 1, kbIgnoreAccess)) ||
+				(walkable(iX, iY + 1, kbIgnoreAccess) && !walkable(iX - kiDX, iY + 1, kbIgnoreAccess))) return uiIndex;
+		}
+		// Else travelling vertically
+		else
+		{
+			// If an obstacle behind opens up beside the Node: it has a forced neighbour
+			if ((walkable(iX - 1, iY, kbIgnoreAccess) && !walkable(iX - 1, iY - kiDY, kbIgnoreAccess)) ||
+				(walkable(iX + 1, iY, kbIgnoreAccess) && !walkable(iX + 1, iY - kiDY, kbIgnoreAccess))) return uiIndex;
+		}
+
+		// If respecting accessibility and the step onward is closed: no jump point this way
+		if ((!kbIgnoreAccess) && (!m_kCells.stepOpen(iX, iY, kiDX, kiDY))) return g_kuiNoNode;
+
+		// Steps to the next Node
+		iX += kiDX;
+		iY += kiDY;
+	}
+}
\ No newline at end of file
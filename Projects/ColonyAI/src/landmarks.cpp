@@ -0,0 +1,132 @@
+/**
+@file landmarks.cpp
+*/
+
+// Imports
+#include "landmarks.h"
+
+// Constructor
+Landmarks::Landmarks(std::shared_ptr<NavGrid> pGrid, const CellGrid& kCells, const unsigned int kuiCount)
+{
+	// Sets member values to corresponding input
+	m_pGrid = pGrid;
+	m_cells = kCells;
+
+	// Distance from the landmarks picked so far to each Node, the nearest of them
+	std::vector<float> nearest(m_pGrid->getNodeCount(), std::numeric_limits<float>::infinity());
+
+	// Distances from the Node being measured from
+	std::vector<float> distances;
+
+	// Index of the first accessible Node, which the first landmark is measured from
+	unsigned int uiSource = 0;
+	while ((uiSource < m_pGrid->getNodeCount()) && m_cells.isBlocked(uiSource)) uiSource++;
+
+	// If every Node is inaccessible: no landmarks
+	if (uiSource == m_pGrid->getNodeCount()) return;
+
+	// Picks the first landmark as far as possible from the first accessible Node
+	spread(uiSource, distances);
+	unsigned int uiNext = uiSource;
+	for (unsigned int uiIndex = 0; uiIndex < m_pGrid->getNodeCount(); uiIndex++)
+	{
+		if ((distances[uiIndex] != std::numeric_limits<float>::infinity()) && (distances[uiIndex] > distances[uiNext])) uiNext = uiIndex;
+	}
+
+	// For the number of landmarks
+	for (unsigned int i = 0; i < kuiCount; i++)
+	{
+		// Adds the landmark and measures from it
+		m_uiLandmarks.push_back(uiNext);
+		spread(uiNext, distances);
+
+		// Stores the distances in quarter pixels, rounded down so bounds stay below the true distance
+		for (unsigned int uiIndex = 0; uiIndex < m_pGrid->getNodeCount(); uiIndex++)
+		{
+			const float kfQuarters = distances[uiIndex] * 4.0f;
+			m_usDistances.push_back((kfQuarters < (float)g_kusUnreachable) ? (unsigned short)kfQuarters : g_kusUnreachable);
+
+			// Keeps the distance to the nearest landmark
+			if (distances[uiIndex] < nearest[uiIndex]) nearest[uiIndex] = distances[uiIndex];
+		}
+
+		// Picks the next landmark as the accessible Node furthest from every landmark, unreachable Nodes first
+		uiNext = g_kuiNoNode;
+		for (unsigned int uiIndex = 0; uiIndex < m_pGrid->getNodeCount(); uiIndex++)
+		{
+			if (m_cells.isBlocked(uiIndex)) continue;
+			if ((uiNext == g_kuiNoNode) || (nearest[uiIndex] > nearest[uiNext])) uiNext = uiIndex;
+		}
+
+		// If every accessible Node is a landmark: stops
+		if ((uiNext == g_kuiNoNode) || (nearest[uiNext] == 0.0f)) return;
+	}
+}
+
+// Float: Determines a lower bound on the path distance between two Nodes - Returns the largest bound any landmark gives, 0 if none reach both Nodes
+float Landmarks::bound(const unsigned int kuiNode, const unsigned int kuiTarget) const
+{
+	// Largest difference found, in quarter pixels
+	int iBest = 0;
+
+	// For all landmarks
+	for (unsigned int i = 0; i < m_uiLandmarks.size(); i++)
+	{
+		// Distances from the landmark to both Nodes
+		const unsigned short kusNode = m_usDistances[(i * m_pGrid->getNodeCount()) + kuiNode];
+		const unsigned short kusTarget = m_usDistances[(i * m_pGrid->getNodeCount()) + kuiTarget];
+
+		// If the landmark can't reach either Node: it gives no bound
+		if ((kusNode == g_kusUnreachable) || (kusTarget == g_kusUnreachable)) continue;
+
+		// Difference less the quarter pixel lost rounding each distance down
+		const int kiBound = abs((int)kusNode - (int)kusTarget) - 1;
+		if (kiBound > iBest) iBest = kiBound;
+	}
+
+	// Returns the bound in pixels
+	return (float)iBest * 0.25f;
+}
+
+// Void: Determines the path distance from a Node to every other Node
+void Landmarks::spread(const unsigned int kuiSource, std::vector<float>& distances) const
+{
+	// Every Node starts unreached
+	distances.assign(m_pGrid->getNodeCount(), std::numeric_limits<float>::infinity());
+
+	// Open list of Nodes by distance
+	std::priority_queue<std::pair<float, unsigned int>, std::vector<std::pair<float, unsigned int>>, std::greater<std::pair<float, unsigned int>>> openNodes;
+
+	// Starts at the source
+	distances[kuiSource] = 0.0f;
+	openNodes.push(std::make_pair(0.0f, kuiSource));
+
+	// While there are Nodes to spread from
+	while (!openNodes.empty())
+	{
+		// Takes the nearest Node
+		const float kfDistance = openNodes.top().first;
+		const unsigned int kuiNode = openNodes.top().second;
+		openNodes.pop();
+
+		// If a shorter distance has since been found: this entry is stale
+		if (kfDistance > distances[kuiNode]) continue;
+
+		// For all neighbours, diagonals only past accessible Nodes
+		for (const unsigned int kuiAdj : m_cells.adjacentNodes<8>(kuiNode, true))
+		{
+			// If the neighbour can't be walked on: skip it
+			if (m_cells.isBlocked(kuiAdj)) continue;
+
+			// Distance to the neighbour through this Node
+			const float kfAdjDistance = kfDistance + Utils::magnitude(m_pGrid->getPosition(kuiAdj) - m_pGrid->getPosition(kuiNode));
+
+			// If shorter than the neighbour's distance: updates it
+			if (kfAdjDistance < distances[kuiAdj])
+			{
+				distances[kuiAdj] = kfAdjDistance;
+				openNodes.push(std::make_pair(kfAdjDistance, kuiAdj));
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -14,6 +14,7 @@
 #include <SFML/Window.hpp>
 #include "environment.h"
 #include "editor.h"
+#include "benchmark.h"
 
 //!< Struct that holds window properties
 struct WindowProperties
@@ -82,20 +83,20 @@ int main()
 	// String for storing user input
 	std::string sInput;
 
-	// Get user input for  whether to load or create while a valid answer has not been given
+	// Get user input for  whether to load, create or benchmark while a valid answer has not been given
 	do 
 	{
-		// Gets user input whether to load or create Environment
-		std::cout << "Load or Create Environment file?: ";
+		// Gets user input whether to load, create or benchmark Environment
+		std::cout << "Load, Create or Benchmark Environment file?: ";
 		std::cin >> sInput;
 
 		// Changes the input to all lowercase chars
 		sInput = Utils::toLowercase(sInput);
 
 		// If input is invalid
-		if (sInput != "load" && sInput != "create") std::cout << "Invalid input" << std::endl;
+		if (sInput != "load" && sInput != "create" && sInput != "benchmark") std::cout << "Invalid input" << std::endl;
 	} 
-	while (sInput != "load" && sInput != "create"); // Checks whether input isn't valid
+	while (sInput != "load" && sInput != "create" && sInput != "benchmark"); // Checks whether input isn't valid
 
 	// Proceed with program
 	// If 'Load' selected
@@ -473,6 +474,28 @@ int main()
 		}
 	}
 
+	// If 'Benchmark' selected
+	else if (sInput == "benchmark")
+	{
+		// Instantiates new Benchmark with a fixed number of queries and seed
+		Benchmark benchmark = Benchmark(500, 1);
+
+		// Get user input for EnvDirectory while a valid directory has not been given
+		do
+		{
+			// Gets user input for the Environment directory
+			std::cout << "Select Environment: 'environments/YOURINPUT.cfg': ";
+			std::cin >> sInput;
+		}
+		while (!benchmark.run("environments/" + sInput + ".cfg")); // Attempts to benchmark an Environment from file directory
+
+		// Times Environment updates over 10000 Objects
+		benchmark.runUpdates(10000, 2000);
+
+		// Times Environment updates of 2000 Colonists at each thread count
+		benchmark.runThreads(2000, 20);
+	}
+
 	// Finishes 'main' with return
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+/**
+@file navgrid.cpp
+*/
+
+// Imports
+#include "navgrid.h"
+
+// Constructor
+NavGrid::NavGrid(const sf::Vector2u kSize, const float kfNodeDiameter)
+{
+	// Sets member values to corresponding input
+	m_fNodeDiameter = kfNodeDiameter;
+	m_fNodeRadius = m_fNodeDiameter / 2;
+
+	// Takes the next id, counted over every grid created in the run
+	static std::atomic<unsigned long long> s_ullNextId(0);
+	m_ullId = ++s_ullNextId;
+
+	sf::err() << "[PATHFINDING] Generating nodes for A* pathfinding..." << std::endl;
+
+	// Divides the map size by the diameter of the Nodes to create a required number of columns and rows in the grid
+	m_uiNodeCols = (unsigned int)floor(kSize.x / m_fNodeDiameter);
+	m_uiNodeRows = (unsigned int)floor(kSize.y / m_fNodeDiameter);
+
+	// Reserves the Node storage
+	m_positions.reserve(m_uiNodeCols * m_uiNodeRows);
+
+	// For the number of Nodes needed for the height
+	for (unsigned int y = 1; y <= m_uiNodeRows; y++)
+	{
+		// For the number of Nodes needed for the width
+		for (unsigned int x = 1; x <= m_uiNodeCols; x++)
+		{
+			// Pushes the position of a new Node onto the Node storage
+			m_positions.push_back(sf::Vector2f((m_fNodeDiameter * x) - m_fNodeRadius, (m_fNodeDiameter * y) - m_fNodeRadius));
+		}
+	}
+
+	// Generates a key for each Node from a fixed seed, so keys match between runs
+	std::mt19937_64 generator(m_uiNodeCols * m_uiNodeRows);
+	m_keys.reserve(m_positions.size());
+	for (unsigned int i = 0; i < m_positions.size(); i++) m_keys.push_back(generator());
+
+	sf::err() << "[PATHFINDING] Generating nodes for A* pathfinding... Finished." << std::endl;
+}
+
+// Unsigned Int: Detemines the index of the Node that a given position falls within - Returns index of the Node at position, g_kuiNoNode if there is none
+unsigned int NavGrid::indexFromPos(const sf::Vector2f kPosition) const
+{
+	// If Nodes exist and the position isn't before the first column or row
+	if ((!m_positions.empty()) && (kPosition.x >= 0.0f) && (kPosition.y >= 0.0f))
+	{
+		// Determines the column that the Node is in
+		const float kfNodeCol = floor(kPosition.x / m_fNodeDiameter);
+
+		// Determines the row that the Node is in
+		const float kfNodeRow = floor(kPosition.y / m_fNodeDiameter);
+
+		// If the column and row are within the grid, not in the strip a diameter that doesn't divide the size leaves: returns the index
+		if ((kfNodeCol < (float)m_uiNodeCols) && (kfNodeRow < (float)m_uiNodeRows)) return (unsigned int)kfNodeCol + (m_uiNodeCols * (unsigned int)kfNodeRow);
+	}
+
+	// Nodes don't exist: return no Node
+	return g_kuiNoNode;
+}
+
+// Node: Gets the Node at a given index with error checks - Returns Node at index
+Node NavGrid::getNode(const unsigned int kuiIndex) const
+{
+	// If index is within available range: returns a handle to the Node
+	if (kuiIndex < m_positions.size()) return Node(m_positions[kuiIndex], kuiIndex);
+
+	// Node doesn't exist: return an invalid Node
+	return Node();
+}
+
+// std::vector<unsigned int>: Determines the Nodes a Colonist can't stand on because of a circular obstacle - Returns indices of the Nodes in ascending order
+std::vector<unsigned int> NavGrid::footprint(const sf::Vector2f kPosition, const float kfRadius, const float kfColonistRadius) const
+{
+	// Declares vector to store the result
+	std::vector<unsigned int> nodes;
+
+	// Furthest a Node can be from the obstacle and still be included
+	const float kfReach = kfRadius + (kfColonistRadius * 1.25f);
+
+	// Columns and rows of the Nodes within reach of the obstacle, one extra each way so rounding can't miss a Node
+	const int kiMinX = Utils::max((long)floor((kPosition.x - kfReach) / m_fNodeDiameter) - 1, 0L);
+	const int kiMaxX = Utils::min((long)floor((kPosition.x + kfReach) / m_fNodeDiameter) + 1, (long)m_uiNodeCols - 1);
+	const int kiMinY = Utils::max((long)floor((kPosition.y - kfReach) / m_fNodeDiameter) - 1, 0L);
+	const int kiMaxY = Utils::min((long)floor((kPosition.y + kfReach) / m_fNodeDiameter) + 1, (long)m_uiNodeRows - 1);
+
+	// For all Nodes in the box around the obstacle's reach
+	for (int iY = kiMinY; iY <= kiMaxY; iY++)
+	{
+		for (int iX = kiMinX; iX <= kiMaxX; iX++)
+		{
+			// Index of the Node
+			const unsigned int kuiIndex = (unsigned int)iX + (m_uiNodeCols * (unsigned int)iY);
+
+			// Defines the clearance, distance from the Node that isn't in the radius
+			const float kfClearance = Utils::magnitude(kPosition - m_positions[kuiIndex]) - kfRadius;
+
+			// If clearance is less than the radius of the Colonist: the Node is included
+			if (kfClearance <= kfColonistRadius*1.25) nodes.push_back(kuiIndex);
+		}
+	}
+
+	return nodes;
+}
\ No newline at end of file
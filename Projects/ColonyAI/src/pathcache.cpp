@@ -0,0 +1,91 @@
+/**
+@file pathcache.cpp
+*/
+
+// Imports
+#include "pathcache.h"
+
+// Constructor
+PathCache::PathCache(const unsigned int kuiCapacity)
+{
+	// Sets member values to corresponding input
+	m_uiCapacity = kuiCapacity;
+}
+
+// PathKey: Creates the key for a path - Returns the key
+PathCache::PathKey PathCache::makeKey(const unsigned int kuiStart, const unsigned int kuiTarget, const int kiMode, const bool kbIgnoreAccess, const unsigned long long kullKnowledge)
+{
+	// When ignoring accessibility the path doesn't depend on knowledge, so every Pathfinding shares it
+	PathKey key = { kuiStart, kuiTarget, kiMode, kbIgnoreAccess, (kbIgnoreAccess) ? 0ULL : kullKnowledge };
+
+	return key;
+}
+
+// Bool: Finds a path, marking it as the most recently used - Returns whether the path was cached
+bool PathCache::find(const unsigned int kuiStart, const unsigned int kuiTarget, const int kiMode, const bool kbIgnoreAccess, const unsigned long long kullKnowledge, std::queue<sf::Vector2f>& path)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	// Looks up the path
+	std::map<PathKey, std::list<PathEntry>::iterator>::iterator it = m_index.find(makeKey(kuiStart, kuiTarget, kiMode, kbIgnoreAccess, kullKnowledge));
+
+	// If there is no path: counts the miss
+	if (it == m_index.end())
+	{
+		m_uiMisses++;
+		return false;
+	}
+
+	// Moves the path to the front of the list as the most recently used
+	m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+	// Counts the hit and copies the path out
+	m_uiHits++;
+	path = it->second->m_path;
+
+	return true;
+}
+
+// Void: Adds a path, dropping the least recently used if full
+void PathCache::insert(const unsigned int kuiStart, const unsigned int kuiTarget, const int kiMode, const bool kbIgnoreAccess, const unsigned long long kullKnowledge, const std::queue<sf::Vector2f>& kPath)
+{
+	// If the cache holds nothing: exit the method
+	if (m_uiCapacity == 0) return;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	// Key of the path
+	const PathKey kKey = makeKey(kuiStart, kuiTarget, kiMode, kbIgnoreAccess, kullKnowledge);
+
+	// If the path is already cached, as when two workers solve the same request: replaces it
+	std::map<PathKey, std::list<PathEntry>::iterator>::iterator it = m_index.find(kKey);
+	if (it != m_index.end())
+	{
+		it->second->m_path = kPath;
+		m_entries.splice(m_entries.begin(), m_entries, it->second);
+		return;
+	}
+
+	// If full: drops the least recently used path
+	if (m_entries.size() >= m_uiCapacity)
+	{
+		m_index.erase(m_entries.back().m_key);
+		m_entries.pop_back();
+	}
+
+	// Adds the path as the most recently used
+	PathEntry entry = { kKey, kPath };
+	m_entries.push_front(entry);
+	m_index[kKey] = m_entries.begin();
+}
+
+// Void: Drops every path and resets the counters
+void PathCache::clear()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	m_entries.clear();
+	m_index.clear();
+	m_uiHits = 0;
+	m_uiMisses = 0;
+}
\ No newline at end of file
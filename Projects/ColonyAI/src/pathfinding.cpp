@@ -11,756 +11,1158 @@ Pathfinding::Pathfinding(const std::shared_ptr<Environment> kpEnvironment)
 	// Sets member values to corresponding input
 	m_pEnv = kpEnvironment;
 
-	sf::err() << "[PATHFINDING] Generating nodes for A* pathfinding..." << std::endl;
+	// Shares the Environment's grid of Nodes
+	m_pGrid = m_pEnv->getNavGrid();
 
-	// Divides the map size by the diameter of the Nodes to create a required number of columns and rows in the grid
-	m_uiNodeCols = (unsigned int)floor(m_pEnv->getSize().x / m_fNodeDiameter);
-	m_uiNodeRows = (unsigned int)floor(m_pEnv->getSize().y / m_fNodeDiameter);
+	// If the Environment has a grid
+	if (m_pGrid != nullptr)
+	{
+		// Borders the grid with off grid cells, every Node inside starts accessible
+		m_cells = CellGrid(m_pGrid->getCols(), m_pGrid->getRows());
+
+		// Creates the cluster graph, built on the first HPA search
+		m_pClusters = std::shared_ptr<ClusterGraph>(new ClusterGraph(m_pGrid, m_kuiClusterSize));
+
+		// Shares the Environment's flow fields
+		m_pFieldCache = m_pEnv->getFlowFields();
+
+		// Shares the Environment's path cache
+		m_pPathCache = m_pEnv->getPathCache();
+
+		// Shares the Environment's landmark tables
+		m_pLandmarks = m_pEnv->getLandmarks();
+
+		// If the tables were built without inaccessible Nodes: their bounds are admissible already
+		m_bLandmarksCovered = (m_pLandmarks != nullptr) && (m_pLandmarks->getBlockedCount() == 0);
+
+		// Flags Nodes as initialised
+		m_bNodesInit = true;
+	}
+}
+
+// Destructor
+Pathfinding::~Pathfinding()
+{
+	// Returns any lent buffers
+	if (m_pReplanner != nullptr) m_pEnv->getReplanners()->release(m_pReplanner);
+	if (m_pSliceBuffer != nullptr) m_pEnv->getSliceBuffers()->release(m_pSliceBuffer);
+}
+
+// SearchBuffer&: Gets a search scratch buffer of the calling thread - Returns the thread's SearchBuffer
+SearchBuffer& Pathfinding::searchBuffer(const unsigned int kuiNodeCount, const unsigned int kuiSlot)
+{
+	// Two buffers per thread, reused by every search on that thread
+	thread_local SearchBuffer buffers[2];
 
-	// For the number of Nodes needed for the height
-	for (unsigned int y = 1; y <= m_uiNodeRows; y++)
+	// Sizes the buffer for the grid
+	buffers[kuiSlot].prepare(kuiNodeCount);
+
+	return buffers[kuiSlot];
+}
+
+// std::ostream&: Gets the stream progress is written to - Returns sf::err(), or a stream that discards everything when logging is off
+std::ostream& Pathfinding::log()
+{
+	// Stream without a buffer, which discards what's written to it
+	thread_local std::ostream nullStream(nullptr);
+
+	// If logging: returns SFML's error stream
+	if (m_bLogging) return sf::err();
+
+	return nullStream;
+}
+
+// std::shared_ptr<Pathfinding>: Copies what's needed to search off the update thread - Returns a Pathfinding that can be searched with on another thread
+std::shared_ptr<Pathfinding> Pathfinding::snapshot(const bool kbWithClusters)
+{
+	// If the search needs the cluster graph: brings it up to date here, so the copy doesn't repair its own
+	if (kbWithClusters)
 	{
-		// For the number of Nodes needed for the width
-		for (unsigned int x = 1; x <= m_uiNodeCols; x++)
+		if (!m_pClusters->isBuilt())
 		{
-			// Pushes a new Node onto vector member of Nodes
-			m_pNodes.push_back(std::shared_ptr<Node>(new Node(sf::Vector2f((m_fNodeDiameter * x) - m_fNodeRadius, (m_fNodeDiameter * y) - m_fNodeRadius), (unsigned int)m_pNodes.size())));
+			log() << "[PATHFINDING] Building cluster graph..." << std::endl;
+			m_pClusters->build(m_cells);
+			log() << "[PATHFINDING] Building cluster graph... Finished." << std::endl;
 		}
+		else m_pClusters->repair(m_cells);
 	}
 
-	// Flags Nodes as initialised
-	m_bNodesInit = true;
+	// Copies this Pathfinding
+	std::shared_ptr<Pathfinding> pSnapshot(new Pathfinding(*this));
+
+	// Gives the copy its own cluster graph, unbuilt if it won't be used, and drops what else it won't use
+	if (kbWithClusters) pSnapshot->m_pClusters = std::shared_ptr<ClusterGraph>(new ClusterGraph(*m_pClusters));
+	else if (m_bNodesInit) pSnapshot->m_pClusters = std::shared_ptr<ClusterGraph>(new ClusterGraph(m_pGrid, m_kuiClusterSize));
+	pSnapshot->m_pReplanner = nullptr;
+	pSnapshot->m_pendingPath = std::shared_future<PathResult>();
+	pSnapshot->m_pFlowFields.clear();
+	pSnapshot->m_changedNodes.clear();
+	pSnapshot->m_pPaths = std::shared_ptr<std::vector<Path>>(new std::vector<Path>(1));
+	pSnapshot->m_uiPathSlot = 0;
+	pSnapshot->m_pSliceBuffer = nullptr;
+	pSnapshot->m_bSlicing = false;
+
+	// Keeps the copy quiet, sf::err() isn't safe to write to from the workers
+	pSnapshot->m_bLogging = false;
+
+	return pSnapshot;
+}
 
-	sf::err() << "[PATHFINDING] Generating nodes for A* pathfinding... Finished." << std::endl;
+// Void: Requests a path to target Node from the Environment's workers
+void Pathfinding::requestPathTo(const sf::Vector2f kCurrentPos, const Node kTargetNode, const bool kbIgnoreAccess)
+{
+	// Path request workers of the Environment, looked up on each request as the thread count can change
+	std::shared_ptr<PathService> pPathService = m_pEnv->getPathService();
+
+	// If there are no workers: searches a slice at a time on the update thread
+	if (pPathService == nullptr)
+	{
+		beginSlicedPath(kCurrentPos, kTargetNode, kbIgnoreAccess);
+		return;
+	}
+
+	// Index of the Node at your current location
+	const unsigned int kuiStart = (m_bNodesInit) ? m_pGrid->indexFromPos(kCurrentPos) : g_kuiNoNode;
+
+	// If the target can't be reached: drops the path now rather than sending a request that will fail
+	if ((!kbIgnoreAccess) && (kuiStart != g_kuiNoNode) && (kTargetNode.getIndex() < m_pGrid->getNodeCount()) && (!reachable(kuiStart, kTargetNode.getIndex())))
+	{
+		log() << "[PATHFINDING] Generating path... Error - Target node unreachable." << std::endl;
+		setPath(std::queue<sf::Vector2f>());
+		return;
+	}
+
+	// Whether the search will go over the cluster graph, the same test createPathTo makes
+	const bool kbWithClusters = (m_searchMode == HPA) && (!kbIgnoreAccess) && (kuiStart != g_kuiNoNode) && (kTargetNode.getIndex() < m_pGrid->getNodeCount()) && (!m_pClusters->clustersNear(kuiStart, kTargetNode.getIndex()));
+
+	// Submits the request with a snapshot to search
+	m_pendingPath = pPathService->submit(snapshot(kbWithClusters), kCurrentPos, kTargetNode, kbIgnoreAccess);
+}
+
+// Void: Starts a time-sliced search, expanded by collectPath within the Environment's budget
+void Pathfinding::beginSlicedPath(const sf::Vector2f kCurrentPos, const Node kTargetNode, const bool kbIgnoreAccess)
+{
+	// Drops any search already in progress
+	m_bSlicing = false;
+
+	// Index of the Node at your current location
+	const unsigned int kuiStart = (m_bNodesInit) ? m_pGrid->indexFromPos(kCurrentPos) : g_kuiNoNode;
+
+	// If a search would fail or finish without expanding, or goes over the cluster graph: creates the path now, the same as createPathTo
+	if ((kuiStart == g_kuiNoNode) || (kTargetNode.getIndex() >= m_pGrid->getNodeCount()) || ((!kbIgnoreAccess) && (!reachable(kuiStart, kTargetNode.getIndex()))) ||
+		((m_searchMode == HPA) && (!kbIgnoreAccess) && (!m_pClusters->clustersNear(kuiStart, kTargetNode.getIndex()))))
+	{
+		setPath(createPathTo(kCurrentPos, kTargetNode, kbIgnoreAccess));
+		return;
+	}
+
+	// If a path between the Nodes was created with the same knowledge: reuses it
+	std::queue<sf::Vector2f> path;
+	if (m_pPathCache->find(kuiStart, kTargetNode.getIndex(), ASTAR, kbIgnoreAccess, m_ullKnowledge, path))
+	{
+		setPath((kbIgnoreAccess) ? std::move(path) : smoothPath(path));
+		return;
+	}
+
+	log() << "[PATHFINDING] Generating path... Time-sliced." << std::endl;
+
+	// Borrows the search state kept between updates
+	if (m_pSliceBuffer == nullptr) m_pSliceBuffer = m_pEnv->getSliceBuffers()->acquire();
+
+	// Starts a new search generation from the current Node
+	m_pSliceBuffer->prepare(m_pGrid->getNodeCount());
+	m_pSliceBuffer->beginSearch();
+	m_pSliceBuffer->visit(kuiStart);
+	m_pSliceBuffer->close(kuiStart);
+
+	// Stores where the search is
+	m_uiSliceStart = kuiStart;
+	m_uiSliceCurrent = kuiStart;
+	m_uiSliceTarget = kTargetNode.getIndex();
+	m_bSliceIgnoreAccess = kbIgnoreAccess;
+	m_ullSliceKnowledge = m_ullKnowledge;
+	m_bSlicing = true;
+
+	// Expands what's left of this update's budget, so short searches finish straight away
+	collectPath();
+}
+
+// Bool: Sets the path to the result of the last request if it has arrived - Returns whether a result was collected
+bool Pathfinding::collectPath()
+{
+	// If a time-sliced search is in progress
+	if (m_bSlicing)
+	{
+		// Expands as far as the Environment's budget allows
+		AStarSearch search(*m_pGrid, m_cells, m_heuristic, admissibleLandmarks(), log());
+		std::queue<sf::Vector2f> path;
+		const SearchStatus kStatus = search.expand(*m_pSliceBuffer, m_uiSliceCurrent, m_uiSliceTarget, m_bSliceIgnoreAccess, m_pEnv->getExpansionsLeft(), path);
+		m_uiExpansions += search.getExpansions();
+		m_pEnv->spendExpansions(search.getExpansions());
+
+		// If the search is still going: nothing to collect yet
+		if (kStatus == SEARCHING) return false;
+
+		// Search is over, returns its state
+		m_bSlicing = false;
+		m_pEnv->getSliceBuffers()->release(m_pSliceBuffer);
+
+		// If nothing new became known while searching: stores the path for later requests between the same Nodes
+		if (m_ullKnowledge == m_ullSliceKnowledge) m_pPathCache->insert(m_uiSliceStart, m_uiSliceTarget, ASTAR, m_bSliceIgnoreAccess, m_ullKnowledge, path);
+
+		// Sets the path, empty if none was found, smoothed unless it ignores accessibility
+		releaseReplanner();
+		currentPath().assign((m_bSliceIgnoreAccess) ? std::move(path) : smoothPath(path));
+
+		return true;
+	}
+
+	// If no request is pending or its result hasn't arrived: nothing to collect
+	if ((!m_pendingPath.valid()) || (m_pendingPath.wait_for(std::chrono::seconds(0)) != std::future_status::ready)) return false;
+
+	// Takes the result
+	PathResult result = m_pendingPath.get();
+	m_pendingPath = std::shared_future<PathResult>();
+
+	// Sets the path and counts the expansions made finding it
+	releaseReplanner();
+	currentPath().assign(std::move(result.m_path));
+	m_uiExpansions += result.m_uiExpansions;
+
+	return true;
 }
 
 // Void: Calculates which Nodes are accessible
 void Pathfinding::calcAccess(const float kfColonistRadius, const sf::Vector2f kPosition, const float kfRadius)
 {
-	sf::err() << "[PATHFINDING] Calculating node accessibility..." << std::endl;
+	// If Nodes have not been initialised: exit the method
+	if (!m_bNodesInit) return;
 
-	// For all Nodes
-	for (std::shared_ptr<Node> pNode : m_pNodes)
+	// Marks the Nodes the obstacle covers
+	markInaccessible(m_pGrid->footprint(kPosition, kfRadius, kfColonistRadius));
+}
+
+// Void: Calculates which Nodes are accessible with a known Object
+void Pathfinding::calcAccess(const float kfColonistRadius, const std::shared_ptr<Object> kpObject)
+{
+	// If Nodes have not been initialised: exit the method
+	if (!m_bNodesInit) return;
+
+	// If the Environment's footprints were built for this radius: marks the Object's footprint, shared by every Pathfinding
+	if (kfColonistRadius == m_pEnv->getColonistRadius()) markInaccessible(m_pEnv->getFootprint(kpObject));
+
+	// Else: works the footprint out for this radius
+	else calcAccess(kfColonistRadius, kpObject->getPosition(), kpObject->getRadius());
+}
+
+// Void: Marks Nodes as inaccessible
+void Pathfinding::markInaccessible(const std::vector<unsigned int>& kNodes)
+{
+	log() << "[PATHFINDING] Calculating node accessibility..." << std::endl;
+
+	// Whether any Node became inaccessible
+	bool bChanged = false;
+
+	// For all Nodes to mark
+	for (unsigned int uiIndex : kNodes)
 	{
-		// If Node is accessible
-		if (pNode->isAccessible())
+		// If Node was accessible: sets it as inaccessible
+		if (m_cells.block(uiIndex))
 		{
-			// Defines the distance from the Node to the point
-			float fDistToMem = Utils::magnitude(kPosition - pNode->getPosition());
-			// Defines the clearance, amount of the distance that isn't in the radius
-			float fClearance = fDistToMem - kfRadius;
 
-			// If clearance is less than the radius of the Colonist
-			if (fClearance <= kfColonistRadius*1.25)
-			{
-				// Sets Node as inaccessible
-				pNode->setAccessible(false);
-			}
+			// Adds the Node's key to the knowledge key
+			m_ullKnowledge ^= m_pGrid->getKey(uiIndex);
+
+			// Flags the Node's cluster for repair
+			m_pClusters->touch(uiIndex);
+
+			// If a replanner is lent: records the change for it
+			if (m_pReplanner != nullptr) m_changedNodes.push_back(uiIndex);
+
+			// If the landmark tables were built with the Node inaccessible: counts it towards their bounds being admissible
+			if ((m_pLandmarks != nullptr) && m_pLandmarks->builtBlocked(uiIndex)) m_uiLandmarkBlockedKnown++;
+
+			// Flags that Nodes changed
+			bChanged = true;
 		}
 	}
 
-	sf::err() << "[PATHFINDING] Calculating node accessibility... Finished." << std::endl;
+	// If Nodes changed and the landmark bounds weren't admissible yet: checks whether they are now
+	if (bChanged && (m_pLandmarks != nullptr) && (!m_bLandmarksCovered)) m_bLandmarksCovered = (m_uiLandmarkBlockedKnown == m_pLandmarks->getBlockedCount());
+
+	// If Nodes changed and the path now passes through them: repairs the path
+	if (bChanged && pathBlocked()) repairPath();
+
+	log() << "[PATHFINDING] Calculating node accessibility... Finished." << std::endl;
 }
 
 // std::queue<sf::Vector2f>: Creates a path to target Node
-std::queue<sf::Vector2f> Pathfinding::createPathTo(const sf::Vector2f kCurrentPos, std::shared_ptr<Node> kpTargetNode, const bool kbIgnoreAccess)
+std::queue<sf::Vector2f> Pathfinding::createPathTo(const sf::Vector2f kCurrentPos, const Node kTargetNode, const bool kbIgnoreAccess)
+{
+	// Searches with the selected algorithm
+	return createPathTo(kCurrentPos, kTargetNode, kbIgnoreAccess, m_searchMode);
+}
+
+// std::queue<sf::Vector2f>: Creates a path to target Node with a given search algorithm
+std::queue<sf::Vector2f> Pathfinding::createPathTo(const sf::Vector2f kCurrentPos, const Node kTargetNode, const bool kbIgnoreAccess, const SearchMode kMode)
 {
-	sf::err() << "[PATHFINDING] Generating path..." << std::endl;
+	log() << "[PATHFINDING] Generating path..." << std::endl;
 
 	// Creates an empty path queue
 	std::queue<sf::Vector2f> nullPath;
 
 	// If targetNode doesn't exist
-	if (kpTargetNode == nullptr) 
+	if ((!m_bNodesInit) || (kTargetNode.getIndex() >= m_pGrid->getNodeCount()))
 	{
-		sf::err() << "[PATHFINDING] Generating path... Error - Target node nullptr." << std::endl;
+		log() << "[PATHFINDING] Generating path... Error - Target node invalid." << std::endl;
 		return nullPath;
 	}
 
+	// Index of the target Node
+	const unsigned int kuiTarget = kTargetNode.getIndex();
+
 	// If not ignoring accessibility and If targetNode is inaccessible
-	if ((!kbIgnoreAccess) && (!kpTargetNode->isAccessible()))
+	if ((!kbIgnoreAccess) && (!isAccessible(kuiTarget)))
 	{
-		sf::err() << "[PATHFINDING] Generating path... Error - Target node inaccessible." << std::endl;
+		log() << "[PATHFINDING] Generating path... Error - Target node inaccessible." << std::endl;
 		return nullPath;
 	}
 
-	// If Nodes initialised
-	if (m_bNodesInit)
+	///////////////////// Creating Open and Closed Lists /////////////////////
+
+	// Gets this thread's search state
+	SearchBuffer& buffer = searchBuffer(m_pGrid->getNodeCount(), 0);
+
+	// Starts a new search generation, leaving the open and closed lists empty
+	buffer.beginSearch();
+
+	// Index of the Node at your current location
+	unsigned int uiCurrent = m_pGrid->indexFromPos(kCurrentPos);
+
+	// If Node closest to your current location exists
+	if (uiCurrent != g_kuiNoNode)
+	{
+		// Resets the current Node
+		buffer.visit(uiCurrent);
+		// Add Node at your current location to closed list
+		buffer.close(uiCurrent);
+	}
+	// There is no Node 
+	else
+	{
+		log() << "[PATHFINDING] Generating path... Error - No available node." << std::endl;
+		return nullPath;
+	}
+
+	// If not ignoring accessibility and If targetNode is in a group of Nodes you can't reach
+	if ((!kbIgnoreAccess) && (!reachable(uiCurrent, kuiTarget)))
+	{
+		log() << "[PATHFINDING] Generating path... Error - Target node unreachable." << std::endl;
+		return nullPath;
+	}
+
+	// Queue to store the output
+	std::queue<sf::Vector2f> path;
+
+	// If a path between the Nodes was created with the same knowledge: reuses it
+	if (m_pPathCache->find(uiCurrent, kuiTarget, kMode, kbIgnoreAccess, m_ullKnowledge, path))
+	{
+		log() << "[PATHFINDING] Generating path... Finished - Cached." << std::endl;
+		return (kbIgnoreAccess) ? path : smoothPath(path);
+	}
+
+	// Index of the Node the search starts from, as uiCurrent is moved by the search
+	const unsigned int kuiStart = uiCurrent;
+
+	// If searching with Jump Point Search: searches from the current Node
+	if (kMode == JPS)
+	{
+		JumpPointSearch search(*m_pGrid, m_cells, m_heuristic, admissibleLandmarks(), log());
+		path = search.search(buffer, uiCurrent, kuiTarget, kbIgnoreAccess);
+		m_uiExpansions += search.getExpansions();
+	}
+
+	// Else If searching from both ends: searches from the current Node and the target, with this thread's second search state for the end at the target
+	else if (kMode == BIDIRECTIONAL)
+	{
+		BidirectionalSearch search(*m_pGrid, m_cells, m_heuristic, admissibleLandmarks(), log());
+		path = search.search(buffer, searchBuffer(m_pGrid->getNodeCount(), 1), uiCurrent, kuiTarget, kbIgnoreAccess);
+		m_uiExpansions += search.getExpansions();
+	}
+
+	// Else If searching hierarchically, respecting accessibility, and the target is further than the neighbouring clusters
+	else if ((kMode == HPA) && (!kbIgnoreAccess) && (!m_pClusters->clustersNear(uiCurrent, kuiTarget)))
+	{
+		// Searches over the cluster graph
+		path = HierarchicalSearch(*m_pClusters, *m_pGrid, m_cells, log()).search(uiCurrent, kuiTarget);
+	}
+
+	///////////////////// Calculating The Path /////////////////////
+
+	// If no path was found yet: searches with A* without a budget, which HPA falls back to
+	if ((path.empty()) && ((kMode == ASTAR) || (kMode == HPA)))
+	{
+		AStarSearch search(*m_pGrid, m_cells, m_heuristic, admissibleLandmarks(), log());
+		search.expand(buffer, uiCurrent, kuiTarget, kbIgnoreAccess, g_kuiUnlimitedBudget, path);
+		m_uiExpansions += search.getExpansions();
+	}
+
+	// Stores the path for later requests between the same Nodes
+	m_pPathCache->insert(kuiStart, kuiTarget, kMode, kbIgnoreAccess, m_ullKnowledge, path);
+
+	// Smooths the path unless it ignores accessibility, in which case every Node on it is wanted
+	return (kbIgnoreAccess) ? path : smoothPath(path);
+}
+
+// std::queue<sf::Vector2f>: Creates a path to the nearest perimeter Node of a target by following its flow field - Returns a queue of points that represent a route
+std::queue<sf::Vector2f> Pathfinding::createFlowPath(const sf::Vector2f kCurrentPos, const sf::Vector2f kTargetPos, const float kfTargetRadius)
+{
+	log() << "[PATHFINDING] Generating flow path..." << std::endl;
+
+	// Creates the path queue
+	std::queue<sf::Vector2f> path;
+
+	// If Nodes have not been initialised: return empty path
+	if (!m_bNodesInit) return path;
+
+	// Index of the Node at your current location
+	const unsigned int kuiStart = m_pGrid->indexFromPos(kCurrentPos);
+
+	// If there is no Node at your current location: return empty path
+	if (kuiStart == g_kuiNoNode)
 	{
-		///////////////////// Creating Open and Closed Lists /////////////////////
+		log() << "[PATHFINDING] Generating flow path... Error - No available node." << std::endl;
+		return path;
+	}
+
+	// Gets the field leading to the target
+	std::shared_ptr<FlowField> pField = flowField(kTargetPos, kfTargetRadius);
+
+	// If the target has no accessible perimeter: return empty path
+	if (pField == nullptr)
+	{
+		log() << "[PATHFINDING] Generating flow path... Error - Target has no accessible nodes." << std::endl;
+		return path;
+	}
 
-		// Declares vectors to store nodes to check and checked nodes
-		std::vector<std::shared_ptr<Node>> pOpenNodes;
-		std::vector<std::shared_ptr<Node>> pClosedNodes;
+	// If the field doesn't reach your current location, which happens when standing on an inaccessible Node: searches to the perimeter instead
+	if (!pField->reaches(kuiStart)) return createPathToNearest(kCurrentPos, kTargetPos, kfTargetRadius);
 
-		// If Node closest to your current location exists
-		if (nodeFromPos(kCurrentPos) != nullptr)
+	// If already at a seed: there is no path to take
+	if (pField->nextStep(kuiStart) == g_kuiNoNode)
+	{
+		log() << "[PATHFINDING] Generating flow path... CurrentNode is on the perimeter." << std::endl;
+		return path;
+	}
+
+	// Follows the field from your current location to a seed
+	for (unsigned int uiNode = kuiStart; uiNode != g_kuiNoNode; uiNode = pField->nextStep(uiNode))
+	{
+		// If the field steps past a Node this Pathfinding knows is inaccessible, which the Environment's footprints don't cover: searches to the perimeter instead
+		if ((pField->nextStep(uiNode) != g_kuiNoNode) && (!m_cells.stepOpen(uiNode, pField->nextStep(uiNode)))) return createPathToNearest(kCurrentPos, kTargetPos, kfTargetRadius);
+
+		path.push(m_pGrid->getPosition(uiNode));
+	}
+
+	log() << "[PATHFINDING] Generating flow path... Finished." << std::endl;
+	return smoothPath(path);
+}
+
+// std::queue<sf::Vector2f>: Creates a path to the nearest perimeter Node of a target that can be reached - Returns a queue of points that represent a route
+std::queue<sf::Vector2f> Pathfinding::createPathToNearest(const sf::Vector2f kCurrentPos, const sf::Vector2f kTargetPos, const float kfTargetRadius)
+{
+	// Determines the nearest perimeter Node you can reach
+	Node nearestNode;
+	for (const Node& kNode : perimeterNodes(kTargetPos, kfTargetRadius, kCurrentPos))
+	{
+		if ((!nearestNode.isValid()) || (Utils::magnitude(kNode.getPosition() - kCurrentPos) < Utils::magnitude(nearestNode.getPosition() - kCurrentPos))) nearestNode = kNode;
+	}
+
+	// If none can be reached: return empty path
+	if (!nearestNode.isValid())
+	{
+		log() << "[PATHFINDING] Generating flow path... Error - Target unreachable." << std::endl;
+		return std::queue<sf::Vector2f>();
+	}
+
+	// Searches to it
+	return createPathTo(kCurrentPos, nearestNode, false);
+}
+
+// std::shared_ptr<FlowField>: Gets a flow field to a target over the Nodes every Object's footprint covers - Returns the field, nullptr if the target has no accessible perimeter
+std::shared_ptr<FlowField> Pathfinding::flowField(const sf::Vector2f kTargetPos, const float kfTargetRadius)
+{
+	// Nodes every Object's footprint covers, and their key
+	const CellGrid& kStaticCells = m_pEnv->getStaticCells();
+	const unsigned long long kullStaticKnowledge = m_pEnv->getStaticKnowledge();
+
+	// Field previously held for the target
+	std::shared_ptr<FlowField> pHeld;
+
+	// For all held fields
+	for (unsigned int i = 0; i < m_pFlowFields.size(); i++)
+	{
+		// If the field leads to the target
+		if ((m_pFlowFields.at(i)->getTargetPos() == kTargetPos) && (m_pFlowFields.at(i)->getTargetRadius() == kfTargetRadius))
 		{
-			// Add Node at your current location to closed list
-			pClosedNodes.push_back(nodeFromPos(kCurrentPos));
-			// Resets the current Node
-			pClosedNodes.back()->reset();
+			// Stops holding the field, it's held again as the most recently used if it's current
+			pHeld = m_pFlowFields.at(i);
+			m_pFlowFields.erase(m_pFlowFields.begin() + i);
+
+			// If the field matches the footprints: use it
+			if (pHeld->getKnowledge() == kullStaticKnowledge)
+			{
+				m_pFlowFields.push_back(pHeld);
+				return pHeld;
+			}
+
+			break;
 		}
-		// There is no Node 
+	}
+
+	// Looks for a field shared by another Pathfinding
+	std::shared_ptr<FlowField> pField = m_pFieldCache->find(kTargetPos, kfTargetRadius, kullStaticKnowledge);
+
+	// If there isn't one
+	if (pField == nullptr)
+	{
+		// Determines the perimeter the field leads to
+		std::vector<unsigned int> seeds;
+		for (const Node& kNode : perimeterNodes(kTargetPos, kfTargetRadius, kStaticCells)) seeds.push_back(kNode.getIndex());
+
+		// If there is no perimeter: no field
+		if (seeds.empty()) return nullptr;
+
+		// If the held field has the same perimeter and only lacks newly inaccessible Nodes
+		if ((pHeld != nullptr) && (pHeld->getSeeds() == seeds) && pHeld->canRepairTo(kStaticCells))
+		{
+			// Repairs a copy, the held field may be shared
+			pField = std::shared_ptr<FlowField>(new FlowField(*pHeld));
+			pField->repair(kStaticCells, kullStaticKnowledge);
+		}
+		// Else: computes a new field
+		else
+		{
+			pField = std::shared_ptr<FlowField>(new FlowField(m_pGrid, kTargetPos, kfTargetRadius));
+			pField->integrate(seeds, kStaticCells, kullStaticKnowledge);
+		}
+
+		// Shares the field
+		m_pFieldCache->insert(pField);
+	}
+
+	// Holds the field, dropping the least recently used if too many are held
+	m_pFlowFields.push_back(pField);
+	if (m_pFlowFields.size() > m_kuiFlowFieldLimit) m_pFlowFields.erase(m_pFlowFields.begin());
+
+	return pField;
+}
+
+// Bool: Returns whether the path ends at the perimeter of a target - Returns whether the path leads to the target
+bool Pathfinding::pathLeadsTo(const sf::Vector2f kTargetPos, const float kfTargetRadius)
+{
+	// If there is no path: it leads nowhere
+	if (currentPath().empty()) return false;
+
+	// Max distance a perimeter Node can be from the target: radius + max diagonal distance a Node can be from radius
+	const float kfMaxDist = kfTargetRadius + Utils::magnitude(sf::Vector2f(m_pGrid->getNodeDiameter(), m_pGrid->getNodeDiameter()));
+
+	// Leads to the target if the last point is within reach of it
+	return Utils::magnitude(currentPath().back() - kTargetPos) <= kfMaxDist;
+}
+
+
+// Bool: Determines whether a straight line between two Nodes crosses only accessible Nodes - Returns whether there is line of sight between the Nodes
+bool Pathfinding::lineOfSight(const unsigned int kuiFrom, const unsigned int kuiTo)
+{
+	// If either Node is outside the grid: no line of sight
+	if ((kuiFrom >= m_pGrid->getNodeCount()) || (kuiTo >= m_pGrid->getNodeCount())) return false;
+
+	// Column and row of both Nodes
+	int iX = (int)(kuiFrom % m_pGrid->getCols());
+	int iY = (int)(kuiFrom / m_pGrid->getCols());
+	const int kiToX = (int)(kuiTo % m_pGrid->getCols());
+	const int kiToY = (int)(kuiTo / m_pGrid->getCols());
+
+	// Distance and direction to step in each axis
+	const int kiDX = abs(kiToX - iX);
+	const int kiDY = abs(kiToY - iY);
+	const int kiStepX = (kiToX > iX) ? 1 : -1;
+	const int kiStepY = (kiToY > iY) ? 1 : -1;
+
+	// Which axis the line crosses into next, positive for x and negative for y, doubled to stay in whole numbers
+	int iError = kiDX - kiDY;
+
+	// If the start isn't walkable: no line of sight
+	if (!m_cells.walkable(iX, iY)) return false;
+
+	// For every Node boundary the line crosses
+	for (int iCrossings = kiDX + kiDY; iCrossings > 0;)
+	{
+		// If the line crosses a column boundary first: steps across it
+		if (iError > 0)
+		{
+			iX += kiStepX;
+			iError -= 2 * kiDY;
+			iCrossings--;
+		}
+		// Else If the line crosses a row boundary first: steps across it
+		else if (iError < 0)
+		{
+			iY += kiStepY;
+			iError += 2 * kiDX;
+			iCrossings--;
+		}
+		// Else the line passes through a corner: both Nodes beside it must be walkable
 		else
 		{
-			sf::err() << "[PATHFINDING] Generating path... Error - No available node." << std::endl;
-			return nullPath;
+			if ((!m_cells.walkable(iX + kiStepX, iY)) || (!m_cells.walkable(iX, iY + kiStepY))) return false;
+
+			iX += kiStepX;
+			iY += kiStepY;
+			iError += 2 * (kiDX - kiDY);
+			iCrossings -= 2;
 		}
 
-		///////////////////// Calculating The Path /////////////////////
+		// If the Node crossed into isn't walkable: no line of sight
+		if (!m_cells.walkable(iX, iY)) return false;
+	}
+
+	return true;
+}
 
-		// Bool for whether a path has been found
-		bool bPathFound = false;
+// std::queue<sf::Vector2f>: Removes waypoints that can be walked past in a straight line, if smoothing is on - Returns the smoothed route
+std::queue<sf::Vector2f> Pathfinding::smoothPath(const std::queue<sf::Vector2f>& kPath)
+{
+	// If not smoothing or there are no waypoints in between to remove: the path is unchanged
+	if ((!m_bSmoothing) || (kPath.size() < 3)) return kPath;
+
+	// Copies the points out of the queue
+	std::queue<sf::Vector2f> pathDupe = kPath;
+	std::vector<sf::Vector2f> points;
+	while (!pathDupe.empty())
+	{
+		points.push_back(pathDupe.front());
+		pathDupe.pop();
+	}
 
-		// While a path has not been found
-		while (!bPathFound)
+	// Queue to store the smoothed path, starting at the first point
+	std::queue<sf::Vector2f> smoothed;
+	smoothed.push(points.front());
+
+	// Index of the Node of the last point kept
+	unsigned int uiAnchor = m_pGrid->indexFromPos(points.front());
+
+	// For every point after the next
+	for (unsigned int i = 2; i < points.size(); i++)
+	{
+		// If the point can't be seen from the last point kept: keeps the point before it
+		if (!lineOfSight(uiAnchor, m_pGrid->indexFromPos(points.at(i))))
 		{
-			///////////////////// Setting Up The Current Node /////////////////////
+			smoothed.push(points.at(i - 1));
+			uiAnchor = m_pGrid->indexFromPos(points.at(i - 1));
+		}
+	}
 
-			// Current Node being tested
-			std::shared_ptr<Node> pCurrentNode = pClosedNodes.back();
+	// Keeps the last point
+	smoothed.push(points.back());
 
-			// Sets the currentNode's heuristic as the manhattan distance from the Node to the target
-			pCurrentNode->setH(distance(pCurrentNode, kpTargetNode));
+	return smoothed;
+}
 
-			// If Current Node is actually the Target Node
-			if (pCurrentNode == kpTargetNode)
+// Void: Labels each group of accessible Nodes connected to each other
+void Pathfinding::labelComponents(std::vector<unsigned int>& labels)
+{
+	// Every Node starts unlabelled
+	labels.assign(m_pGrid->getNodeCount(), g_kuiNoNode);
+
+	// Stack of Nodes to spread the current label from
+	std::vector<unsigned int> openNodes;
+
+	// Label given to the next group found
+	unsigned int uiLabel = 0;
+
+	// For all Nodes
+	for (unsigned int uiIndex = 0; uiIndex < m_pGrid->getNodeCount(); uiIndex++)
+	{
+		// If the Node is inaccessible or already labelled: skips it
+		if ((!isAccessible(uiIndex)) || (labels[uiIndex] != g_kuiNoNode)) continue;
+
+		// Starts a new group at the Node
+		labels[uiIndex] = uiLabel;
+		openNodes.push_back(uiIndex);
+
+		// While the group has Nodes to spread from
+		while (!openNodes.empty())
+		{
+			// Takes a Node off the stack
+			const unsigned int kuiNode = openNodes.back();
+			openNodes.pop_back();
+
+			// For the 4 orthogonal neighbours
+			for (const unsigned int kuiAdj : m_cells.adjacentNodes<4>(kuiNode, false))
 			{
-				sf::err() << "[PATHFINDING] Generating path... CurrentNode equal to TargetNode." << std::endl;
-				bPathFound = true;
-				return nullPath;
+				// If the neighbour is accessible and unlabelled: adds it to the group
+				if ((!isAccessible(kuiAdj)) || (labels[kuiAdj] != g_kuiNoNode)) continue;
+
+				labels[kuiAdj] = uiLabel;
+				openNodes.push_back(kuiAdj);
 			}
+		}
 
-			///////////////////// Calculating Open Adjacent Nodes /////////////////////
+		// The next group gets a new label
+		uiLabel++;
+	}
+}
 
-			// Get all adjacent nodes
-			std::vector<std::shared_ptr<Node>> pAdjNodes = adjacentNodes(pCurrentNode, !kbIgnoreAccess);
+// const std::vector<unsigned int>&: Gets the connected group labels for what this Pathfinding knows - Returns label of the group each Node is in
+const std::vector<unsigned int>& Pathfinding::components()
+{
+	//!< Struct that holds the labels of one set of inaccessible Nodes
+	struct Labelling
+	{
+		unsigned long long m_ullGridId; //!< Id of the grid the labels cover
+		unsigned long long m_ullKnowledge; //!< Knowledge key of the inaccessible Nodes labelled around
+		std::vector<unsigned int> m_uiLabels; //!< Label of the group each Node is in
+	};
 
-			// For all adjacent nodes
-			for (std::shared_ptr<Node> pAdjNode : pAdjNodes)
-			{
-				// If not ignoring accessibility and If adjNode is inaccessible
-				if ((!kbIgnoreAccess) && (!pAdjNode->isAccessible())) { /* Ignores inaccessible Nodes */ }
+	// Labellings kept by this thread, most recently used first
+	thread_local std::vector<Labelling> labellings;
+	const unsigned int kuiLabellings = 4;
 
-				// Else If adjNode is the target destination
-				else if (pAdjNode == kpTargetNode)
-				{
-					// Resets the adjacent Node
-					pAdjNode->reset();
-
-					// Sets adj parent to the current node
-					pAdjNode->setParent(pCurrentNode);
-					// Sets the adjNode's heuristic as the manhattan distance from the Node to the target
-					pAdjNode->setH(distance(pAdjNode, kpTargetNode));
-					// Sets the adjNode's G value
-					pAdjNode->setG(calcG(pCurrentNode, pAdjNode));
-					// Sets the adjNode's F value (G+H)
-					pAdjNode->setF(pAdjNode->getG() + pAdjNode->getH());
-
-					// Destination found, create path
-					std::queue<sf::Vector2f> path(queuePath(pAdjNode));
-					sf::err() << "[PATHFINDING] Generating path... Finished." << std::endl;
-					bPathFound = true;
-					return path;
-				}
+	// For all labellings kept
+	for (unsigned int i = 0; i < labellings.size(); i++)
+	{
+		// If it labels what this Pathfinding knows: moves it to the front and uses it
+		if ((labellings[i].m_ullGridId == m_pGrid->getId()) && (labellings[i].m_ullKnowledge == m_ullKnowledge))
+		{
+			std::rotate(labellings.begin(), labellings.begin() + i, labellings.begin() + i + 1);
+			return labellings.front().m_uiLabels;
+		}
+	}
 
-				// Else If adjNode is on the open list already
-				else if (nodeInVector(pAdjNode, pOpenNodes))
-				{
-					// If (total movement cost to adjcent node through current Node) is less than (total movement cost to adjNode)
-					if (pCurrentNode->getG() + Utils::magnitude(pCurrentNode->getPosition() - pAdjNode->getPosition()) < pAdjNode->getG())
-					{
-						// Sets adj parent to the closed node
-						pAdjNode->setParent(pCurrentNode);
-					}
-				}
+	// If there's room: adds a labelling, else reuses the least recently used one's storage
+	if (labellings.size() < kuiLabellings) labellings.push_back(Labelling());
+	std::rotate(labellings.begin(), labellings.end() - 1, labellings.end());
 
-				// Else if adjNode is on the closed list
-				else if (nodeInVector(pAdjNode, pClosedNodes)) { /* Ignores Nodes already processed */ }
+	// Labels the groups for what this Pathfinding knows
+	labellings.front().m_ullGridId = m_pGrid->getId();
+	labellings.front().m_ullKnowledge = m_ullKnowledge;
+	labelComponents(labellings.front().m_uiLabels);
 
-				// Else: adjNode is accessible, not the destination and is not on the open or closed list
-				else
-				{
-					// Resets the adjacent Node
-					pAdjNode->reset();
-
-					// Sets adj parent to the current node
-					pAdjNode->setParent(pCurrentNode);
-					// Sets the adjNode's heuristic as the manhattan distance from the Node to the target
-					pAdjNode->setH(distance(pAdjNode, kpTargetNode));
-					// Sets the adjNode's G value
-					pAdjNode->setG(calcG(pCurrentNode, pAdjNode));
-					// Sets the adjNode's F value (G+H)
-					pAdjNode->setF(pAdjNode->getG() + pAdjNode->getH());
-
-					// Add adjacent nodes to open list
-					pOpenNodes.push_back(pAdjNode);
-				}
-			}
+	return labellings.front().m_uiLabels;
+}
 
-			///////////////////// Determining Next Closed Node /////////////////////
+// Bool: Returns whether a path respecting accessibility can exist between two Nodes - Returns whether the Node can be reached
+bool Pathfinding::reachable(const unsigned int kuiFrom, const unsigned int kuiTo)
+{
+	// If either Node doesn't exist or the target is inaccessible: it can't be reached
+	if ((!m_bNodesInit) || (kuiFrom >= m_pGrid->getNodeCount()) || (kuiTo >= m_pGrid->getNodeCount()) || (!isAccessible(kuiTo))) return false;
 
-			// If there is an open list
-			if (!pOpenNodes.empty())
-			{
-				// Variable to store current Node with smallest F value
-				std::shared_ptr<Node> pSmallestFNode = pOpenNodes.back(); // Sets starting Node with smallest F value to the first Node in the vector
+	// Labels of the groups for what this Pathfinding knows
+	const std::vector<unsigned int>& kComponents = components();
 
-				// For all open nodes
-				for (std::shared_ptr<Node> pNode : pOpenNodes)
-				{
-					// If Node.F is less than currSmallest->f
-					if (pNode->getF() < pSmallestFNode->getF())
-					{
-						// nodeWithSmallestF replaced with this Node
-						pSmallestFNode.swap(pNode);
-					}
-					// Else If two Nodes have the same F value
-					else if (pNode->getF() == pSmallestFNode->getF())
-					{
-						// The Node with lowest H is set
-						if (pNode->getH() < pSmallestFNode->getH()) pSmallestFNode.swap(pNode);
-					}
-				}
+	// If the start is accessible: reachable if it's in the same group
+	if (isAccessible(kuiFrom)) return kComponents[kuiFrom] == kComponents[kuiTo];
 
-				// Adds Node with smallest F value to the closed list
-				pClosedNodes.push_back(pSmallestFNode);
+	// Else reachable if an accessible orthogonal neighbour, which the search steps out to, is in the same group
+	for (unsigned int uiAdj : m_cells.adjacentNodes<4>(kuiFrom, false))
+	{
+		if (isAccessible(uiAdj) && (kComponents[uiAdj] == kComponents[kuiTo])) return true;
+	}
 
-				// Removes the Node with the smalled F value from the open list
-				std::vector<std::shared_ptr<Node>> pNewOpenNodes;
-				for (std::shared_ptr<Node> pOpenNode : pOpenNodes)
-				{
-					// If the openNode doesn't have the smallest F value
-					if (pOpenNode != pSmallestFNode)
-					{
-						// Pushes onto new open list
-						pNewOpenNodes.push_back(pOpenNode);
-					}
-				}
-				// Replaces open list with new edited copy
-				pOpenNodes.swap(pNewOpenNodes);
+	return false;
+}
+
+// Void: Refines the leg of the path from a reached point to the front of the queue
+void Pathfinding::refinePath(const sf::Vector2f kReached)
+{
+	// Indices of the leg's waypoints
+	const unsigned int kuiFrom = m_pGrid->indexFromPos(kReached);
+	const unsigned int kuiTo = m_pGrid->indexFromPos(currentPath().front());
+
+	// If either waypoint is outside the grid: nothing to refine
+	if ((kuiFrom == g_kuiNoNode) || (kuiTo == g_kuiNoNode)) return;
+
+	// If the leg crosses clusters, which happens once a repair or smoothing has moved the waypoints: replans to the end of the path
+	if (m_pClusters->clusterOf(kuiFrom) != m_pClusters->clusterOf(kuiTo))
+	{
+		log() << "[PATHFINDING] Refining path... Leg crosses clusters, replanning." << std::endl;
+		std::queue<sf::Vector2f> replanned = createPathTo(kReached, m_pGrid->getNode(m_pGrid->indexFromPos(currentPath().back())), false);
+
+		// Drops the point already reached, then replaces the path, empty if the end can't be reached
+		if (!replanned.empty()) replanned.pop();
+		currentPath().assign(std::move(replanned));
+		return;
+	}
+
+	// Refines the leg within its cluster
+	std::vector<unsigned int> leg = m_pClusters->refine(kuiFrom, kuiTo, m_cells);
+
+	// If the leg has become blocked: drops the path so a new one is made
+	if (leg.empty())
+	{
+		log() << "[PATHFINDING] Refining path... Error - Leg blocked, path cleared." << std::endl;
+		clearPath();
+		return;
+	}
+
+	// Queue to store the refined path
+	std::queue<sf::Vector2f> refined;
+
+	// Pushes the Nodes of the leg, the last of which is the waypoint
+	refined.push(kReached);
+	for (unsigned int uiNode : leg) refined.push(m_pGrid->getPosition(uiNode));
+
+	// Smooths the leg, then drops the point already reached
+	refined = smoothPath(refined);
+	refined.pop();
+
+	// Pushes the rest of the path after the waypoint
+	currentPath().pop();
+	for (const sf::Vector2f& kPoint : currentPath()) refined.push(kPoint);
+
+	// Replaces the path
+	currentPath().assign(std::move(refined));
+}
+
+// Bool: Returns whether the path steps onto or diagonally past an inaccessible Node - Returns whether the path is blocked
+bool Pathfinding::pathBlocked()
+{
+	// Index of the last point checked
+	unsigned int uiLast = g_kuiNoNode;
+
+	// For every point left in the path
+	for (const sf::Vector2f& kPoint : currentPath())
+	{
+		// Index of the point's Node
+		const unsigned int kuiNode = m_pGrid->indexFromPos(kPoint);
+
+		// If the point's Node is inaccessible: blocked
+		if (!isAccessible(kuiNode)) return true;
+
+		// If the step from the last point is diagonal between neighbouring Nodes
+		if (uiLast != g_kuiNoNode)
+		{
+			const int kiLastX = (int)(uiLast % m_pGrid->getCols());
+			const int kiLastY = (int)(uiLast / m_pGrid->getCols());
+			const int kiX = (int)(kuiNode % m_pGrid->getCols());
+			const int kiY = (int)(kuiNode / m_pGrid->getCols());
+
+			if ((abs(kiX - kiLastX) == 1) && (abs(kiY - kiLastY) == 1))
+			{
+				// If either Node cut past is inaccessible: blocked
+				if ((!isAccessible((unsigned int)kiX + (m_pGrid->getCols() * (unsigned int)kiLastY))) || (!isAccessible((unsigned int)kiLastX + (m_pGrid->getCols() * (unsigned int)kiY)))) return true;
 			}
-			// Else the open list is empty
-			else
+			// Else If the step is a straight line past neighbouring Nodes, from a jump, smoothing or an unrefined HPA leg
+			else if ((abs(kiX - kiLastX) > 1) || (abs(kiY - kiLastY) > 1))
 			{
-				sf::err() << "[PATHFINDING] Generating path... Error - No path found." << std::endl;
-				return nullPath;
+				// If the line crosses an inaccessible Node: blocked
+				if (!lineOfSight(uiLast, kuiNode)) return true;
 			}
 		}
+
+		uiLast = kuiNode;
 	}
 
-	// Else Nodes have not been intitialised
-	else { sf::err() << "[PATHFINDING] Generating path... Error - Nodes not intitialised." << std::endl; }
+	return false;
 }
 
-// std::shared_ptr<Node>: Detemines the Node that a given position falls within
-std::shared_ptr<Node> Pathfinding::nodeFromPos(const sf::Vector2f kPosition)
+// Void: Repairs the path around newly inaccessible Nodes with the replanner
+void Pathfinding::repairPath()
 {
-	// If Nodes exist
-	if (!m_pNodes.empty())
+	log() << "[PATHFINDING] Repairing path..." << std::endl;
+
+	// If no replanner is lent: borrows one, which plans from nothing
+	if (m_pReplanner == nullptr)
 	{
-		// Determines the column that the Node is in
-		unsigned int uiNodeCol = (unsigned int)floor(kPosition.x / m_fNodeDiameter);
+		m_pReplanner = m_pEnv->getReplanners()->acquire();
+		m_pReplanner->reset();
+		m_changedNodes.clear();
+	}
 
-		// Determines the row that the Node is in
-		unsigned int uiNodeRow = (unsigned int)floor(kPosition.y / m_fNodeDiameter);
+	// Replans from the front of the path to its end, counting the expansions
+	const unsigned int kuiExpansions = m_pReplanner->getExpansions();
+	std::vector<unsigned int> nodes = m_pReplanner->plan(m_pGrid->indexFromPos(currentPath().front()), m_pGrid->indexFromPos(currentPath().back()), m_changedNodes, m_cells);
+	m_uiExpansions += m_pReplanner->getExpansions() - kuiExpansions;
 
-		// Determines the Index using the column and row
-		unsigned int uiNodeIndex = uiNodeCol + (m_uiNodeCols * uiNodeRow);
+	// The replanner has taken the changes
+	m_changedNodes.clear();
 
-		// If the index is within the vector
-		if (uiNodeIndex < m_pNodes.size())
-		{
-			// Returns the Node
-			return m_pNodes.at(uiNodeIndex);
-		}
+	// If the end can no longer be reached: drops the path so a new one is made
+	if (nodes.empty())
+	{
+		log() << "[PATHFINDING] Repairing path... Error - End unreachable, path cleared." << std::endl;
+		clearPath();
+		return;
 	}
 
-	// Nodes don't exist: return nullptr
-	return nullptr;
+	// Queue to store the repaired path
+	std::queue<sf::Vector2f> repaired;
+	for (unsigned int uiNode : nodes) repaired.push(m_pGrid->getPosition(uiNode));
+
+	// Replaces the path with the smoothed repair
+	currentPath().assign(smoothPath(repaired));
+
+	log() << "[PATHFINDING] Repairing path... Finished." << std::endl;
+}
+
+// Void: Sets the path, dropping any pending request
+void Pathfinding::setPath(std::queue<sf::Vector2f> path)
+{
+	// Drops any pending request or time-sliced search, returning its state
+	m_pendingPath = std::shared_future<PathResult>();
+	m_bSlicing = false;
+	if (m_pSliceBuffer != nullptr) m_pEnv->getSliceBuffers()->release(m_pSliceBuffer);
+
+	// The replanner's plan was for the old path
+	releaseReplanner();
+
+	currentPath().assign(std::move(path));
 }
 
-// std::shared_ptr<Node>: Detemines the Node that a given position falls within
-std::shared_ptr<Node> Pathfinding::nodeFromIndex(const unsigned int kuiIndex)
+// Void: Moves the path into a slot of a store shared with its owner, and keeps it there
+void Pathfinding::setPathStore(std::shared_ptr<std::vector<Path>> pPaths, const unsigned int kuiSlot)
 {
-	// If Nodes exist
-	if (!m_pNodes.empty())
+	// Moves the route into the slot, unless it's already there
+	if ((pPaths != m_pPaths) || (kuiSlot != m_uiPathSlot)) (*pPaths)[kuiSlot] = std::move(currentPath());
+
+	// Sets member values to corresponding input
+	m_pPaths = pPaths;
+	m_uiPathSlot = kuiSlot;
+}
+
+// Void: Removes every waypoint from the path
+void Pathfinding::clearPath()
+{
+	// The replanner's plan was for the old path
+	releaseReplanner();
+
+	currentPath().clear();
+}
+
+// Size_t: Gets the memory held by this Pathfinding - Returns size in bytes
+size_t Pathfinding::getMemoryUsage()
+{
+	// Counts the inaccessible bits, the path and the Nodes waiting on the replanner
+	size_t memory = m_cells.getMemoryUsage() + currentPath().getMemoryUsage() + (m_changedNodes.capacity() * sizeof(unsigned int));
+
+	// Counts the cluster graph and any buffers lent
+	if (m_pClusters != nullptr) memory += m_pClusters->getMemoryUsage();
+	if (m_pReplanner != nullptr) memory += m_pReplanner->getMemoryUsage();
+	if (m_pSliceBuffer != nullptr) memory += m_pSliceBuffer->getMemoryUsage();
+
+	// Counts the flow fields held
+	for (const std::shared_ptr<FlowField>& kpField : m_pFlowFields) memory += kpField->getMemoryUsage();
+
+	return memory;
+}
+
+// Void: Returns the replanner to the Environment, forgetting its plan
+void Pathfinding::releaseReplanner()
+{
+	// If no replanner is lent: nothing to return
+	if (m_pReplanner == nullptr) return;
+
+	m_pEnv->getReplanners()->release(m_pReplanner);
+	m_changedNodes.clear();
+}
+
+// Void: Pops the first element off the path queue
+void Pathfinding::popPath()
+{
+	// Point being reached
+	const sf::Vector2f kReached = currentPath().front();
+
+	// Removes it from the path
+	currentPath().pop();
+
+	// Refines the leg after it
+	reachedWaypoint(kReached);
+}
+
+// Void: Refines the leg after a waypoint that's been reached and removed from the path
+void Pathfinding::reachedWaypoint(const sf::Vector2f kReached)
+{
+	// If searching hierarchically and the next point isn't a neighbouring Node or in a straight line: refines the leg to it
+	if ((m_searchMode == HPA) && (m_bNodesInit) && (!currentPath().empty()) && (Utils::magnitude(currentPath().front() - kReached) > m_pGrid->getNodeDiameter() * 1.5f) &&
+		(!lineOfSight(m_pGrid->indexFromPos(kReached), m_pGrid->indexFromPos(currentPath().front()))))
 	{
-		// If index is within available range
-		if ((kuiIndex >= 0) && (kuiIndex < m_pNodes.size()))
-		{
-			// Returns Node at index
-			return m_pNodes.at(kuiIndex);
-		}
+		refinePath(kReached);
 	}
+}
 
-	// Nodes don't exist: return nullptr
-	return nullptr;
+// Bool: Returns whether a Node is accessible as far as this Pathfinding knows - Returns whether the Node is accessible
+bool Pathfinding::isAccessible(const Node kNode)
+{
+	// Checks the Node's index
+	return isAccessible(kNode.getIndex());
+}
+
+// Bool: Returns whether the Node at an index is accessible as far as this Pathfinding knows - Returns whether the Node is accessible
+bool Pathfinding::isAccessible(const unsigned int kuiIndex)
+{
+	// If the Node is outside the grid: inaccessible
+	if (kuiIndex >= m_cells.getNodeCount()) return false;
+
+	// Returns the inverse of the Node's inaccessible bit
+	return !m_cells.isBlocked(kuiIndex);
+}
+
+// Node: Detemines the Node that a given position falls within
+Node Pathfinding::nodeFromPos(const sf::Vector2f kPosition)
+{
+	// If Nodes initialised: returns the grid's Node
+	if (m_bNodesInit) return m_pGrid->getNode(m_pGrid->indexFromPos(kPosition));
+
+	// Nodes don't exist: return an invalid Node
+	return Node();
 }
 
-// std::shared_ptr<Node>: Detemines the closest accessible Node to a given position
-std::vector<std::shared_ptr<Node>> Pathfinding::perimeterNodes(const sf::Vector2f kPosition, const float kfRadius)
+// Node: Gets the Node at a given index with error checks
+Node Pathfinding::nodeFromIndex(const unsigned int kuiIndex)
+{
+	// If Nodes initialised: returns the grid's Node
+	if (m_bNodesInit) return m_pGrid->getNode(kuiIndex);
+
+	// Nodes don't exist: return an invalid Node
+	return Node();
+}
+
+// std::vector<Node>: Detemines the closest accessible Nodes to a given position
+std::vector<Node> Pathfinding::perimeterNodes(const sf::Vector2f kPosition, const float kfRadius)
+{
+	// Detemines them over the Nodes this Pathfinding knows are inaccessible
+	return perimeterNodes(kPosition, kfRadius, m_cells);
+}
+
+// std::vector<Node>: Detemines the closest accessible Nodes to a given position over a set of inaccessible Nodes
+std::vector<Node> Pathfinding::perimeterNodes(const sf::Vector2f kPosition, const float kfRadius, const CellGrid& kCells)
 {
 	// Declares vector to store the result
-	std::vector<std::shared_ptr<Node>> pResultNodes;
+	std::vector<Node> resultNodes;
+
+	// If Nodes have not been initialised: return empty vector
+	if (!m_bNodesInit) return resultNodes;
+
+	// Index of the Node at the position
+	const unsigned int kuiStart = m_pGrid->indexFromPos(kPosition);
 
-	// If Nodes exist
-	if (!m_pNodes.empty())
+	// If Node at the position exists
+	if (kuiStart != g_kuiNoNode)
 	{
 		// If Node at the position is accessible
-		if (nodeFromPos(kPosition)->isAccessible())
+		if (!kCells.isBlocked(kuiStart))
 		{
-			pResultNodes.push_back(nodeFromPos(kPosition)); // Adds Node at position to result vector
-			return pResultNodes; // Returns vector with single Node within
+			resultNodes.push_back(m_pGrid->getNode(kuiStart)); // Adds Node at position to result vector
+			return resultNodes; // Returns vector with single Node within
 		}
 
 		// Else - Node at position is inaccessible
 		else
 		{
-			// Declares vectors to store nodes to check and checked nodes
-			std::vector<std::shared_ptr<Node>> pOpenNodes;
-			std::vector<std::shared_ptr<Node>> pClosedNodes;
+			// Declares vector to store node indices to check
+			std::vector<unsigned int> openNodes;
+
+			// Uses this thread's search state for the closed list
+			SearchBuffer& buffer = searchBuffer(m_pGrid->getNodeCount(), 0);
+			buffer.beginSearch();
+
+			// Current Node being tested
+			unsigned int uiCurrent = kuiStart;
 
 			// Add Node the position to closed list - It's been checked
-			pClosedNodes.push_back(nodeFromPos(kPosition));
+			buffer.close(uiCurrent);
 
-			// Bool for whether a Node has been found
-			bool bNodeFound = false;
+			// Max distance a Node can be from the position: Given radius + max diagonal distance a Node can be from radius
+			const float kfMaxDist = kfRadius + Utils::magnitude(sf::Vector2f(m_pGrid->getNodeDiameter(), m_pGrid->getNodeDiameter()));
 
 			// While a Node has not been found
-			while (!bNodeFound)
+			while (true)
 			{
-				// Current Node being tested
-				std::shared_ptr<Node> pCurrentNode = pClosedNodes.back();
-
-				// Get all adjacent nodes
-				std::vector<std::shared_ptr<Node>> pAdjNodes = adjacentNodes(pCurrentNode, false);
-
 				// For all adjacent nodes
-				for (std::shared_ptr<Node> pAdjNode : pAdjNodes)
+				for (unsigned int uiAdj : kCells.adjacentNodes<8>(uiCurrent, false))
 				{
 					// If adjNode is too far away from position
-					// Distance from Node to pos (Greater Than) Given radius + max diagonal distance a Node can be from radius
-					if (Utils::magnitude(kPosition - pAdjNode->getPosition()) > kfRadius + Utils::magnitude(sf::Vector2f(m_fNodeDiameter, m_fNodeDiameter)))
+					if (Utils::magnitude(kPosition - m_pGrid->getPosition(uiAdj)) > kfMaxDist)
 					{
 						/* Ignores Nodes too far away from position */
 					}
 
 					// Else If adjNode is accessible
-					else if (pAdjNode->isAccessible()) 
+					else if (!kCells.isBlocked(uiAdj)) 
 					{
 						// If Node isn't diagonal to currentNode
 						if (
 							// If Node is Left of CurrentNode
-							(pAdjNode->getIndex() == pCurrentNode->getIndex() - 1) ||
+							(uiAdj == uiCurrent - 1) ||
 							// If Node is Right of CurrentNode
-							(pAdjNode->getIndex() == pCurrentNode->getIndex() + 1) ||
+							(uiAdj == uiCurrent + 1) ||
 							// If Node is Above of CurrentNode
-							(pAdjNode->getIndex() == pCurrentNode->getIndex() - m_uiNodeCols) ||
+							(uiAdj == uiCurrent - m_pGrid->getCols()) ||
 							// If Node is Below of CurrentNode
-							(pAdjNode->getIndex() == pCurrentNode->getIndex() + m_uiNodeCols)
+							(uiAdj == uiCurrent + m_pGrid->getCols())
 						)
 						{
 							// Add adjacent node to resultant list
-							pResultNodes.push_back(pAdjNode);
+							resultNodes.push_back(m_pGrid->getNode(uiAdj));
 						}
 					}
 					
 					// Else if adjNode is on the closed list
-					else if (nodeInVector(pAdjNode, pClosedNodes)) { /* Ignores Nodes already processed */ }
+					else if (buffer.isClosed(uiAdj)) { /* Ignores Nodes already processed */ }
 
 					// Else: adjNode is inaccessible and not on the closed list
 					else
 					{
 						// Add adjacent nodes to open list
-						pOpenNodes.push_back(pAdjNode);
+						openNodes.push_back(uiAdj);
 					}
 				}
 
 				// If there is an open list
-				if (!pOpenNodes.empty())
+				if (!openNodes.empty())
 				{
 					// Adds the first open Node to the closed list
-					pClosedNodes.push_back(pOpenNodes.front());
+					uiCurrent = openNodes.front();
+					buffer.close(uiCurrent);
 
-					// Removes the Node now on the closed list from the open list
-					std::vector<std::shared_ptr<Node>> pNewOpenNodes;
-					for (std::shared_ptr<Node> pOpenNode : pOpenNodes)
-					{
-						// If the openNode isn't the Node just placed onto the closed list
-						if (pOpenNode != pClosedNodes.back())
-						{
-							// Pushes onto new open list
-							pNewOpenNodes.push_back(pOpenNode);
-						}
-					}
-					// Replaces open list with new edited copy
-					pOpenNodes.swap(pNewOpenNodes);
+					// Removes every copy of the Node now on the closed list from the open list
+					openNodes.erase(std::remove(openNodes.begin(), openNodes.end(), uiCurrent), openNodes.end());
 				}
 				// Else the open list is empty
 				else
 				{
 					// Returns a vector of accessible Nodes around the perimeter of the position
-					return pResultNodes;
+					return resultNodes;
 				}
 			}
 		}
 	}
 
 	// Nodes don't exist: return empty vector
-	return pResultNodes;
-}
-
-// Float: Calculates G value of a Node - Returns the calculated G value
-float Pathfinding::calcG(const std::shared_ptr<Node> kpCurrentNode, const std::shared_ptr<Node> kpTargetNode)
-{
-	// Distance from the current Node and open Node
-	float fDistToNode = Utils::magnitude(kpTargetNode->getPosition() - kpCurrentNode->getPosition());
-
-	// Returns resultant G value (distance to next Node plus current Node's G)
-	return fDistToNode + kpCurrentNode->getG();
-}
-
-// Bool: Detemines whether a Node is within a vector of Nodes - Returns whether the Node is in the vector
-bool Pathfinding::nodeInVector(const std::shared_ptr<Node> kpNodeToFind, const std::vector<std::shared_ptr<Node>> kpVector)
-{
-	// If nodeToFind is in the vector: Return True
-	if (std::find(kpVector.begin(), kpVector.end(), kpNodeToFind) != kpVector.end()) return true;
-
-	// Return False: nodeToFind not found
-	return false;
-}
-
-// Float: Detemines the distance from one Node to another with the manhattan algorithm - Returns distance to the end Node
-float Pathfinding::distance(const std::shared_ptr<Node> kpStartNode, const std::shared_ptr<Node> kpEndNode)
-{
-	// Number of Nodes needed horizontally to match destination
-	float fXDist = (kpEndNode->getPosition().x - kpStartNode->getPosition().x) / m_fNodeDiameter;
-
-	// Number of Nodes needed vertically to match destination
-	float fYDist = (kpEndNode->getPosition().y - kpStartNode->getPosition().y) / m_fNodeDiameter;
-
-	// Combines the distances in the x and y axis
-	float fDistance = abs(fXDist) + abs(fYDist);
-
-	// Returns the combined distances, bound to positive
-	return fDistance;
-}
-
-// std::vector<std::shared_ptr<Node>>: Generates a vector of adjacent Nodes that can be pathed to - Returns Nodes adjacent to the given Node
-std::vector<std::shared_ptr<Node>> Pathfinding::adjacentNodes(const std::shared_ptr<Node> kpNode, const bool kbStrictDiagonal)
-{
-	// Defines vector of Nodes to store adjacent Nodes that are identified
-	std::vector<std::shared_ptr<Node>> adjNodes;
-
-	// If Node exists
-	if (kpNode != nullptr)
-	{
-		// Declares Node ptr to hold adjacent Nodes as they're processed
-		std::shared_ptr<Node> adjNode;
-		// Declares an unsigned int for Node index
-		unsigned int uiIndex;
-
-		// For 8 cycles
-		for (unsigned int i = 1; i <= 8; i++)
-		{
-			switch (i)
-			{
-				case 1:
-				{
-					// x o o
-					// o n o
-					// o o o
-					uiIndex = (kpNode->getIndex() - 1) - m_uiNodeCols;
-					adjNode = nodeFromIndex(uiIndex);
-
-					// If Node at position exists
-					if (adjNode != nullptr)
-					{
-						// If diagonal pathing is strict
-						if (kbStrictDiagonal)
-						{
-							// Nodes used to check diagonal accessibility
-							// x o o
-							// c n o
-							// o o o
-							uiIndex = (kpNode->getIndex() - 1);
-							std::shared_ptr<Node> checkNode1 = nodeFromIndex(uiIndex);
-
-							// x c o
-							// o n o
-							// o o o
-							uiIndex = (kpNode->getIndex()) - m_uiNodeCols;
-							std::shared_ptr<Node> checkNode2 = nodeFromIndex(uiIndex);
-
-							// If checkNode1 Node exists and is not accessible
-							if ((checkNode1 != nullptr) && !(checkNode1->isAccessible())) {}
-
-							// Else If checkNode2 Node exists and is not accessible
-							else if ((checkNode2 != nullptr) && !(checkNode2->isAccessible())) {}
-
-							// Both checkNodes exist and are accessible
-							else
-							{
-								// Adds adjacent Node to vector
-								adjNodes.push_back(adjNode);
-							}
-						}
-						else
-						{
-							// Adds adjacent Node to vector
-							adjNodes.push_back(adjNode);
-						}
-					}
-				} break;
-
-				case 2:
-				{
-					// o x o
-					// o n o
-					// o o o
-					uiIndex = (kpNode->getIndex()) - m_uiNodeCols;
-					adjNode = nodeFromIndex(uiIndex);
-
-					// If Node at position exists
-					if (adjNode != nullptr)
-					{
-						// Adds adjacent Node to vector
-						adjNodes.push_back(adjNode);
-					}
-				} break;
-
-				case 3:
-				{
-					// o o x
-					// o n o
-					// o o o
-					uiIndex = (kpNode->getIndex() + 1) - m_uiNodeCols;
-					adjNode = nodeFromIndex(uiIndex);
-
-					// If Node at position exists
-					if (adjNode != nullptr)
-					{
-						// If diagonal pathing is strict
-						if (kbStrictDiagonal)
-						{
-							// Nodes used to check diagonal accessibility
-							// o c x
-							// o n o
-							// o o o
-							uiIndex = (kpNode->getIndex()) - m_uiNodeCols;
-							std::shared_ptr<Node> checkNode1 = nodeFromIndex(uiIndex);
-
-							// o o x
-							// o n c
-							// o o o
-							uiIndex = (kpNode->getIndex() + 1);
-							std::shared_ptr<Node> checkNode2 = nodeFromIndex(uiIndex);
-
-							// If checkNode1 Node exists and is not accessible
-							if ((checkNode1 != nullptr) && !(checkNode1->isAccessible())) {}
-
-							// Else If checkNode2 Node exists and is not accessible
-							else if ((checkNode2 != nullptr) && !(checkNode2->isAccessible())) {}
-
-							// Both checkNodes exist and are accessible
-							else
-							{
-								// Adds adjacent Node to vector
-								adjNodes.push_back(adjNode);
-							}
-						}
-						else
-						{
-							// Adds adjacent Node to vector
-							adjNodes.push_back(adjNode);
-						}
-					}
-				} break;
-
-				case 4:
-				{
-					// o o o
-					// o n x
-					// o o o
-					uiIndex = (kpNode->getIndex() + 1);
-					adjNode = nodeFromIndex(uiIndex);
-
-					// If Node at position exists
-					if (adjNode != nullptr)
-					{
-						// Adds adjacent Node to vector
-						adjNodes.push_back(adjNode);
-					}
-				} break;
-
-				case 5:
-				{
-					// o o o
-					// o n o
-					// o o x
-					uiIndex = (kpNode->getIndex() + 1) + m_uiNodeCols;
-					adjNode = nodeFromIndex(uiIndex);
-
-					// If Node at position exists
-					if (adjNode != nullptr)
-					{
-						// If diagonal pathing is strict
-						if (kbStrictDiagonal)
-						{
-							// Nodes used to check diagonal accessibility
-							// o o o
-							// o n c
-							// o o x
-							uiIndex = (kpNode->getIndex() + 1);
-							std::shared_ptr<Node> checkNode1 = nodeFromIndex(uiIndex);
-
-							// o o o
-							// o n o
-							// o c x
-							uiIndex = (kpNode->getIndex()) + m_uiNodeCols;
-							std::shared_ptr<Node> checkNode2 = nodeFromIndex(uiIndex);
-
-							// If checkNode1 Node exists and is not accessible
-							if ((checkNode1 != nullptr) && !(checkNode1->isAccessible())) {}
-
-							// Else If checkNode2 Node exists and is not accessible
-							else if ((checkNode2 != nullptr) && !(checkNode2->isAccessible())) {}
-
-							// Both checkNodes exist and are accessible
-							else
-							{
-								// Adds adjacent Node to vector
-								adjNodes.push_back(adjNode);
-							}
-						}
-						else
-						{
-							// Adds adjacent Node to vector
-							adjNodes.push_back(adjNode);
-						}
-					}
-				} break;
-
-				case 6:
-				{
-					// o o o
-					// o n o
-					// o x o
-					uiIndex = (kpNode->getIndex()) + m_uiNodeCols;
-					adjNode = nodeFromIndex(uiIndex);
-
-					// If Node at position exists
-					if (adjNode != nullptr)
-					{
-						// Adds adjacent Node to vector
-						adjNodes.push_back(adjNode);
-					}
-				} break;
-
-				case 7:
-				{
-					// o o o
-					// o n o
-					// x o o
-					uiIndex = (kpNode->getIndex() - 1) + m_uiNodeCols;
-					adjNode = nodeFromIndex(uiIndex);
-
-					// If Node at position exists
-					if (adjNode != nullptr)
-					{
-						// If diagonal pathing is strict
-						if (kbStrictDiagonal)
-						{
-							// Nodes used to check diagonal accessibility
-							// o o o
-							// o n o
-							// x c o
-							uiIndex = (kpNode->getIndex()) + m_uiNodeCols;
-							std::shared_ptr<Node> checkNode1 = nodeFromIndex(uiIndex);
-
-							// o o o
-							// c n o
-							// x o o
-							uiIndex = (kpNode->getIndex() - 1);
-							std::shared_ptr<Node> checkNode2 = nodeFromIndex(uiIndex);
-
-							// If checkNode1 Node exists and is not accessible
-							if ((checkNode1 != nullptr) && !(checkNode1->isAccessible())) {}
-
-							// Else If checkNode2 Node exists and is not accessible
-							else if ((checkNode2 != nullptr) && !(checkNode2->isAccessible())) {}
-
-							// Both checkNodes exist and are accessible
-							else
-							{
-								// Adds adjacent Node to vector
-								adjNodes.push_back(adjNode);
-							}
-						}
-						else
-						{
-							// Adds adjacent Node to vector
-							adjNodes.push_back(adjNode);
-						}
-					}
-				} break;
-
-				case 8:
-				{
-					// o o o
-					// x n o
-					// o o o
-					uiIndex = (kpNode->getIndex() - 1);
-					adjNode = nodeFromIndex(uiIndex);
-
-					// If Node at position exists
-					if (adjNode != nullptr)
-					{
-						// Adds adjacent Node to vector
-						adjNodes.push_back(adjNode);
-					}
-				} break;
-			}
-		}
-	}
-
-	return adjNodes;
+	return resultNodes;
 }
 
-// std::queue<sf::Vector2f>: Creates a queue of points from a given destination back to the current position
-std::queue<sf::Vector2f> Pathfinding::queuePath(std::shared_ptr<Node> pTargetNode)
+// std::vector<Node>: Generates a perimeter of Nodes around a given position that can be reached from a point - Returns perimeter Nodes reachable from the point
+std::vector<Node> Pathfinding::perimeterNodes(const sf::Vector2f kPosition, const float kfRadius, const sf::Vector2f kFromPos)
 {
-	// Vector for stack of Nodes to be used in path
-	std::vector<std::shared_ptr<Node>> pNodes;
-
-	// Pushes destination Node onto vector
-	pNodes.push_back(pTargetNode);
+	// Declares vector to store the result
+	std::vector<Node> resultNodes;
 
-	// While Node has a parent
-	while (pTargetNode->getParent() != nullptr)
-	{
-		// Make the Node it's Parent
-		pTargetNode = pTargetNode->getParent();
-		// Push the parent onto the path of Nodes
-		pNodes.push_back(pTargetNode);
-	}
+	// If Nodes have not been initialised: return empty vector
+	if (!m_bNodesInit) return resultNodes;
 
-	// Queue to store the output
-	std::queue<sf::Vector2f> path;
+	// Index of the Node at the point
+	const unsigned int kuiFrom = m_pGrid->indexFromPos(kFromPos);
 
-	// pNodes is not empty
-	while (!pNodes.empty())
+	// For all perimeter Nodes: keeps the ones in a group the point can reach
+	for (const Node& kNode : perimeterNodes(kPosition, kfRadius))
 	{
-		// Pushes the position of Node onto path
-		path.push(pNodes.back()->getPosition());
-		// Pops Node off Vector
-		pNodes.pop_back();
+		if (reachable(kuiFrom, kNode.getIndex())) resultNodes.push_back(kNode);
 	}
 
-	// Returns queued path
-	return path;
+	return resultNodes;
 }
 
 // Void: Draws the path to a display
@@ -773,14 +1175,11 @@ void Pathfinding::draw(const sf::Vector2f kColonistPos, sf::RenderTarget& target
 		// Declares line and colour
 		sf::Vertex line[2];
 		sf::Color colour = sf::Color(255, 0, 0, 255);
-		// Duplicates the path queue
-		std::queue<sf::Vector2f> pathDupe = m_path;
-
-		// If there is a queue
-		if (!pathDupe.empty())
+		// If there is a path
+		if (!currentPath().empty())
 		{
-			// Sets the last point to the first in the queue
-			sf::Vector2f lastPoint = pathDupe.front();
+			// Sets the last point to the next in the path
+			sf::Vector2f lastPoint = currentPath().front();
 
 			// Sets the first point of the line at the position in front of the queue
 			line[0] = sf::Vertex(lastPoint, colour);
@@ -791,17 +1190,16 @@ void Pathfinding::draw(const sf::Vector2f kColonistPos, sf::RenderTarget& target
 			// Draws the line to target
 			target.draw(line, 2, sf::Lines);
 
-			// For every point in the path queue
-			while (!pathDupe.empty())
+			// For every point left in the path
+			for (const sf::Vector2f& kPoint : currentPath())
 			{
 				// Sets the first point of the line to the position of the last position drawn
 				line[0] = sf::Vertex(lastPoint, colour);
 
-				// Sets the second point of the line at the position in front of the queue
-				line[1] = sf::Vertex(pathDupe.front(), colour);
+				// Sets the second point of the line at the point
+				line[1] = sf::Vertex(kPoint, colour);
 
-				lastPoint = pathDupe.front();
-				pathDupe.pop(); // Removes the point from the queue
+				lastPoint = kPoint;
 
 				// Draws the line to target
 				target.draw(line, 2, sf::Lines);
@@ -811,20 +1209,20 @@ void Pathfinding::draw(const sf::Vector2f kColonistPos, sf::RenderTarget& target
 		///////////////////// NODES /////////////////////
 		// Rectangle shape for drawing
 		sf::RectangleShape rectShape;
-		rectShape.setSize(sf::Vector2f(m_fNodeDiameter, m_fNodeDiameter)); // Size of Node
+		rectShape.setSize(sf::Vector2f(m_pGrid->getNodeDiameter(), m_pGrid->getNodeDiameter())); // Size of Node
 		rectShape.setFillColor(sf::Color(0, 0, 0, 0)); // Transparent
 		rectShape.setOutlineColor(sf::Color(255, 0, 0, 255)); // Red
 		rectShape.setOutlineThickness(1.f);
 		rectShape.setOrigin(rectShape.getSize()*0.5f); // Origin center
 
 		// For every Node
-		for (std::shared_ptr<Node> pNode : m_pNodes)
+		for (unsigned int uiIndex = 0; uiIndex < m_pGrid->getNodeCount(); uiIndex++)
 		{
 			// If Node is inaccessible
-			if (!pNode->isAccessible())
+			if (!isAccessible(uiIndex))
 			{
 				// Moves rect to Node position
-				rectShape.setPosition(pNode->getPosition());
+				rectShape.setPosition(m_pGrid->getPosition(uiIndex));
 
 				// Draws rect to target
 				target.draw(rectShape);
@@ -0,0 +1,84 @@
+/**
+@file pathservice.cpp
+*/
+
+// Imports
+#include "pathservice.h"
+#include "pathfinding.h"
+
+// Constructor
+PathService::PathService(const unsigned int kuiWorkers)
+{
+	// Starts the worker threads
+	for (unsigned int i = 0; i < kuiWorkers; i++) m_workers.push_back(std::thread(&PathService::work, this));
+}
+
+// Destructor
+PathService::~PathService()
+{
+	// Flags the workers to exit once the queued requests are solved, and wakes them
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_bStopping = true;
+	}
+	m_requestAdded.notify_all();
+
+	// Waits for every worker to exit
+	for (std::thread& worker : m_workers) worker.join();
+}
+
+// std::shared_future<PathResult>: Queues a request for a path to target Node - Returns future holding the result once a worker has solved it
+std::shared_future<PathResult> PathService::submit(std::shared_ptr<Pathfinding> pSnapshot, const sf::Vector2f kStart, const Node kTarget, const bool kbIgnoreAccess)
+{
+	// Creates the request
+	std::shared_ptr<PathRequest> pRequest(new PathRequest());
+	pRequest->m_pSnapshot = pSnapshot;
+	pRequest->m_start = kStart;
+	pRequest->m_target = kTarget;
+	pRequest->m_bIgnoreAccess = kbIgnoreAccess;
+
+	// Takes the future before a worker can fulfil the promise
+	std::shared_future<PathResult> result = pRequest->m_result.get_future().share();
+
+	// Queues the request and wakes a worker
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_pRequests.push_back(pRequest);
+	}
+	m_requestAdded.notify_one();
+
+	return result;
+}
+
+// Void: Solves requests until the service stops, run by each worker
+void PathService::work()
+{
+	// While the service is running
+	while (true)
+	{
+		// Request to solve
+		std::shared_ptr<PathRequest> pRequest;
+
+		// Waits for a request or for the service to stop
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_requestAdded.wait(lock, [this] { return m_bStopping || !m_pRequests.empty(); });
+
+			// If stopping and every request is solved: exit, so no requester is left with a broken promise
+			if (m_pRequests.empty()) return;
+
+			// Takes the oldest request
+			pRequest = m_pRequests.front();
+			m_pRequests.pop_front();
+		}
+
+		// Solves the request with the snapshot
+		PathResult result;
+		unsigned int uiExpansions = pRequest->m_pSnapshot->getExpansions();
+		result.m_path = pRequest->m_pSnapshot->createPathTo(pRequest->m_start, pRequest->m_target, pRequest->m_bIgnoreAccess);
+		result.m_uiExpansions = pRequest->m_pSnapshot->getExpansions() - uiExpansions;
+
+		// Hands the result back, collected by the requester on the first update after it's ready
+		pRequest->m_result.set_value(result);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+/**
+@file spatialhash.cpp
+*/
+
+// Imports
+#include "spatialhash.h"
+
+// Constructor
+SpatialHash::SpatialHash(const sf::Vector2u kSize, const float kfBucketSize)
+{
+	// Sets member values to corresponding input
+	m_fBucketSize = kfBucketSize;
+
+	// Enough buckets to cover the Environment, at least one
+	m_uiCols = (unsigned int)ceil(kSize.x / m_fBucketSize);
+	m_uiRows = (unsigned int)ceil(kSize.y / m_fBucketSize);
+	if (m_uiCols == 0) m_uiCols = 1;
+	if (m_uiRows == 0) m_uiRows = 1;
+
+	// Every bucket starts empty
+	m_buckets.resize(m_uiCols * m_uiRows);
+}
+
+// Unsigned Int: Gets the column or row of the bucket a coordinate is in - Returns the column or row, clamped to the Environment
+unsigned int SpatialHash::bucketCoord(const float kfCoord, const unsigned int kuiCount) const
+{
+	// If before the first bucket: the first
+	if (kfCoord < 0.0f) return 0;
+
+	// Bucket the coordinate falls in, the last if beyond it
+	const unsigned int kuiCoord = (unsigned int)(kfCoord / m_fBucketSize);
+	return (kuiCoord < kuiCount) ? kuiCoord : kuiCount - 1;
+}
+
+// Unsigned Int: Gets the bucket a point is in - Returns index of the bucket
+unsigned int SpatialHash::bucketFromPos(const sf::Vector2f kPosition) const
+{
+	return bucketCoord(kPosition.x, m_uiCols) + (m_uiCols * bucketCoord(kPosition.y, m_uiRows));
+}
+
+// Void: Adds an item
+void SpatialHash::insert(const unsigned int kuiItem, const sf::Vector2f kPosition, const float kfRadius)
+{
+	// Adds the item to its bucket
+	m_buckets[bucketFromPos(kPosition)].push_back(kuiItem);
+
+	// Widens later queries if the item is the largest yet
+	if (kfRadius > m_fMaxRadius) m_fMaxRadius = kfRadius;
+}
+
+// Void: Moves an item to the bucket of its new centre
+void SpatialHash::move(const unsigned int kuiItem, const sf::Vector2f kFrom, const sf::Vector2f kTo)
+{
+	// Buckets the item leaves and enters
+	const unsigned int kuiFrom = bucketFromPos(kFrom);
+	const unsigned int kuiTo = bucketFromPos(kTo);
+
+	// If it stays in the same bucket: nothing to do
+	if (kuiFrom == kuiTo) return;
+
+	// Removes the item from its old bucket, order within a bucket doesn't matter
+	std::vector<unsigned int>& from = m_buckets[kuiFrom];
+	std::vector<unsigned int>::iterator it = std::find(from.begin(), from.end(), kuiItem);
+	if (it != from.end())
+	{
+		*it = from.back();
+		from.pop_back();
+	}
+
+	// Adds it to the new one
+	m_buckets[kuiTo].push_back(kuiItem);
+}
+
+// Void: Finds the items that may reach within a radius of a point
+void SpatialHash::query(const sf::Vector2f kPosition, const float kfRadius, std::vector<unsigned int>& items) const
+{
+	items.clear();
+
+	// Widens the circle so items centred outside it that still reach it are found
+	const float kfReach = kfRadius + m_fMaxRadius;
+
+	// Range of buckets the widened circle overlaps
+	const unsigned int kuiMinX = bucketCoord(kPosition.x - kfReach, m_uiCols);
+	const unsigned int kuiMaxX = bucketCoord(kPosition.x + kfReach, m_uiCols);
+	const unsigned int kuiMinY = bucketCoord(kPosition.y - kfReach, m_uiRows);
+	const unsigned int kuiMaxY = bucketCoord(kPosition.y + kfReach, m_uiRows);
+
+	// Gathers the items of every bucket in range
+	for (unsigned int uiY = kuiMinY; uiY <= kuiMaxY; uiY++)
+	{
+		for (unsigned int uiX = kuiMinX; uiX <= kuiMaxX; uiX++)
+		{
+			const std::vector<unsigned int>& kBucket = m_buckets[uiX + (m_uiCols * uiY)];
+			items.insert(items.end(), kBucket.begin(), kBucket.end());
+		}
+	}
+
+	// Sorts them so callers visit items in the same order as the owner's vector
+	std::sort(items.begin(), items.end());
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+/**
+@file workerpool.cpp
+*/
+
+// Imports
+#include "workerpool.h"
+
+// Constructor
+WorkerPool::WorkerPool(const unsigned int kuiWorkers)
+{
+	// Starts the worker threads, each with the share after the calling thread's
+	for (unsigned int i = 0; i < kuiWorkers; i++) m_workers.push_back(std::thread(&WorkerPool::work, this, i + 1));
+}
+
+// Destructor
+WorkerPool::~WorkerPool()
+{
+	// Flags the workers to exit and wakes them
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_bStopping = true;
+	}
+	m_jobStarted.notify_all();
+
+	// Waits for every worker to exit
+	for (std::thread& worker : m_workers) worker.join();
+}
+
+// Void: Runs a task for every index up to a count, returning once all have finished
+void WorkerPool::run(const unsigned int kuiCount, const std::function<void(const unsigned int)>& kTask)
+{
+	// Starts the job and wakes the workers
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_task = kTask;
+		m_uiCount = kuiCount;
+		m_uiBusy = (unsigned int)m_workers.size();
+		m_uiJob++;
+	}
+	m_jobStarted.notify_all();
+
+	// Runs the first share on this thread
+	runShare(0);
+
+	// Waits for the workers to finish theirs
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_shareFinished.wait(lock, [this] { return m_uiBusy == 0; });
+}
+
+// Void: Runs the task over one share of the current job's indices
+void WorkerPool::runShare(const unsigned int kuiShare)
+{
+	// Contiguous range of indices in the share, sizes differing by one at most
+	const unsigned long long kullShares = getThreadCount();
+	const unsigned int kuiFirst = (unsigned int)((m_uiCount * (unsigned long long)kuiShare) / kullShares);
+	const unsigned int kuiEnd = (unsigned int)((m_uiCount * (unsigned long long)(kuiShare + 1)) / kullShares);
+
+	// Runs the task with each index
+	for (unsigned int i = kuiFirst; i < kuiEnd; i++) m_task(i);
+}
+
+// Void: Runs a share of each job until the pool stops, run by each worker
+void WorkerPool::work(const unsigned int kuiShare)
+{
+	// Last job this worker ran its share of
+	unsigned int uiJob = 0;
+
+	// While the pool is running
+	while (true)
+	{
+		// Waits for a new job or for the pool to stop
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_jobStarted.wait(lock, [this, uiJob] { return m_bStopping || (m_uiJob != uiJob); });
+
+			// If stopping: exit
+			if (m_bStopping) return;
+
+			uiJob = m_uiJob;
+		}
+
+		// Runs the share, the job isn't changed until every share has finished
+		runShare(kuiShare);
+
+		// Flags the share as finished
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_uiBusy--;
+		}
+		m_shareFinished.notify_all();
+	}
+}
\ No newline at end of file